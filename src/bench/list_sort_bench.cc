@@ -0,0 +1,61 @@
+// Замер сортировки 1M элементов s21::list в сравнении с std::list::sort.
+// Обе сортировки только перевешивают узлы, поэтому сравнивается сама
+// сортировка слиянием: случайные ключи, уже упорядоченные и обратный порядок.
+// Сборка и запуск: make bench_list_sort
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+constexpr int kCount = 1000000;
+constexpr int kRounds = 3;
+
+template <typename Body>
+double Milliseconds(Body body) {
+  auto start = std::chrono::steady_clock::now();
+  body();
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+// Лучшее из kRounds время сортировки списка из keys
+template <typename List>
+double BestSort(const std::vector<int> &keys, bool &sorted) {
+  double best = 0;
+  for (int round = 0; round < kRounds; ++round) {
+    List list;
+    for (int key : keys) list.push_back(key);
+    double ms = Milliseconds([&list] { list.sort(); });
+    if (round == 0 || ms < best) best = ms;
+    sorted = sorted && std::is_sorted(list.begin(), list.end());
+  }
+  return best;
+}
+
+void Run(const char *name, const std::vector<int> &keys) {
+  bool sorted = true;
+  double s21_ms = BestSort<s21::list<int>>(keys, sorted);
+  double std_ms = BestSort<std::list<int>>(keys, sorted);
+  std::printf("%-8s s21::list %7.1f ms  std::list %7.1f ms%s\n", name, s21_ms,
+              std_ms, sorted ? "" : "  not sorted");
+}
+}  // namespace
+
+int main() {
+  std::vector<int> keys(kCount);
+  std::mt19937 random(42);
+  for (int &key : keys) key = int(random() % kCount);
+  Run("random", keys);
+  std::sort(keys.begin(), keys.end());
+  Run("sorted", keys);
+  std::sort(keys.begin(), keys.end(), std::greater<int>());
+  Run("reverse", keys);
+  return 0;
+}
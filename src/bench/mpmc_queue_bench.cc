@@ -0,0 +1,99 @@
+// Замер пропускной способности s21::mpmc_queue на 1..32 парах писатель +
+// читатель в сравнении с s21::queue под мьютексом и условными
+// переменными той же вместимости. Писатели вместе кладут 4M чисел,
+// читатели забирают их до close(); сумма проверяет, что ничего не
+// потерялось.
+// Сборка и запуск: make bench_mpmc_queue
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+constexpr long kCount = 4000000;
+constexpr std::size_t kCapacity = 1024;
+
+// Обычная ограниченная очередь: один мьютекс на все операции
+class LockedQueue {
+ public:
+  bool push(long value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] { return queue_.size() < kCapacity; });
+    queue_.push(value);
+    lock.unlock();
+    not_empty_.notify_one();
+    return true;
+  }
+
+  bool pop(long &value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return !queue_.empty() || closed_; });
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    lock.unlock();
+    not_full_.notify_one();
+    return true;
+  }
+
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+    }
+    not_empty_.notify_all();
+  }
+
+ private:
+  s21::queue<long> queue_;
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  bool closed_ = false;
+};
+
+// Миллионы операций в секунду для threads писателей и threads читателей
+template <typename Queue>
+double Run(Queue &queue, int threads) {
+  auto start = std::chrono::steady_clock::now();
+  std::atomic<long> sum{0};
+  std::vector<std::thread> producers;
+  std::vector<std::thread> consumers;
+  for (int i = 0; i < threads; ++i) {
+    producers.emplace_back([&queue, i, threads] {
+      for (long value = i; value < kCount; value += threads) queue.push(value);
+    });
+    consumers.emplace_back([&queue, &sum] {
+      long value;
+      long local = 0;
+      while (queue.pop(value)) local += value;
+      sum += local;
+    });
+  }
+  for (std::thread &producer : producers) producer.join();
+  queue.close();
+  for (std::thread &consumer : consumers) consumer.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  if (sum != kCount * (kCount - 1) / 2) std::printf("lost elements\n");
+  return double(kCount) / elapsed.count() / 1e6;
+}
+}  // namespace
+
+int main() {
+  for (int threads : {1, 2, 4, 8, 16, 32}) {
+    s21::mpmc_queue<long> lock_free(kCapacity);
+    LockedQueue locked;
+    double lock_free_rate = Run(lock_free, threads);
+    double locked_rate = Run(locked, threads);
+    std::printf("%2d + %2d threads: mpmc_queue %6.1f Mops/s  mutex queue "
+                "%6.1f Mops/s\n",
+                threads, threads, lock_free_rate, locked_rate);
+  }
+  return 0;
+}
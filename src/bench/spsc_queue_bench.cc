@@ -0,0 +1,139 @@
+// Замер s21::spsc_queue на двух потоках: пропускная способность поштучных
+// push/pop и пакетных push_n/pop_n в сравнении с s21::queue под мьютексом,
+// и задержка - время круга "пинг-понг" через две очереди.
+// Сборка и запуск: make bench_spsc_queue
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#include "../s21_containersplus.h"
+
+namespace {
+constexpr long kCount = 20000000;
+constexpr long kRoundTrips = 200000;
+constexpr std::size_t kBatch = 64;
+
+// Очереди статические: кольцо лежит внутри объекта и велико для стека
+s21::spsc_queue<long, 4096> single_queue;
+s21::spsc_queue<long, 4096> batch_queue;
+s21::spsc_queue<long, 64> ping;
+s21::spsc_queue<long, 64> pong;
+
+template <typename Body>
+double Milliseconds(Body body) {
+  auto start = std::chrono::steady_clock::now();
+  body();
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+long SingleTransfer() {
+  long sum = 0;
+  std::thread producer([] {
+    for (long i = 0; i < kCount;) {
+      if (single_queue.push(i))
+        ++i;
+      else
+        std::this_thread::yield();
+    }
+  });
+  long value;
+  for (long i = 0; i < kCount;) {
+    if (single_queue.pop(value)) {
+      sum += value;
+      ++i;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  return sum;
+}
+
+long BatchTransfer() {
+  long sum = 0;
+  std::thread producer([] {
+    long batch[kBatch];
+    for (long i = 0; i < kCount;) {
+      for (std::size_t k = 0; k < kBatch; ++k) batch[k] = i + long(k);
+      std::size_t count = std::size_t(kCount - i) < kBatch
+                              ? std::size_t(kCount - i)
+                              : kBatch;
+      long pushed = long(batch_queue.push_n(batch, count));
+      if (pushed == 0) std::this_thread::yield();
+      i += pushed;
+    }
+  });
+  long batch[kBatch];
+  for (long i = 0; i < kCount;) {
+    long popped = long(batch_queue.pop_n(batch, kBatch));
+    if (popped == 0) std::this_thread::yield();
+    for (long k = 0; k < popped; ++k) sum += batch[k];
+    i += popped;
+  }
+  producer.join();
+  return sum;
+}
+
+long LockedTransfer() {
+  s21::queue<long> queue;
+  std::mutex mutex;
+  long sum = 0;
+  std::thread producer([&queue, &mutex] {
+    for (long i = 0; i < kCount; ++i) {
+      std::lock_guard<std::mutex> lock(mutex);
+      queue.push(i);
+    }
+  });
+  for (long i = 0; i < kCount;) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!queue.empty()) {
+      sum += queue.front();
+      queue.pop();
+      ++i;
+    } else {
+      lock.unlock();
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  return sum;
+}
+
+void PingPong() {
+  std::thread echo([] {
+    long value;
+    for (long i = 0; i < kRoundTrips; ++i) {
+      while (!ping.pop(value)) std::this_thread::yield();
+      pong.push(value);
+    }
+  });
+  long value;
+  for (long i = 0; i < kRoundTrips; ++i) {
+    ping.push(i);
+    while (!pong.pop(value)) std::this_thread::yield();
+  }
+  echo.join();
+}
+
+void Report(const char *name, double ms, long sum) {
+  const char *status = sum == kCount * (kCount - 1) / 2 ? "" : "  wrong sum";
+  std::printf("%-18s %6.1f Mops/s%s\n", name, double(kCount) / ms / 1e3,
+              status);
+}
+}  // namespace
+
+int main() {
+  long sum = 0;
+  double ms = Milliseconds([&sum] { sum = SingleTransfer(); });
+  Report("spsc push/pop", ms, sum);
+  ms = Milliseconds([&sum] { sum = BatchTransfer(); });
+  Report("spsc push_n/pop_n", ms, sum);
+  ms = Milliseconds([&sum] { sum = LockedTransfer(); });
+  Report("mutex + s21::queue", ms, sum);
+  ms = Milliseconds(PingPong);
+  std::printf("spsc round trip    %6.2f us\n", ms * 1e3 / double(kRoundTrips));
+  return 0;
+}
@@ -0,0 +1,60 @@
+// Замер красно-черного дерева на 1M ключей int с двумя аллокаторами узлов:
+// пулом блоков s21::NodePool(как в s21::set) и s21::NodeHeapAllocator,
+// который берет каждый узел отдельно у std::allocator. Вставки и удаления
+// идут в перемешанном порядке, результат - миллионы операций в секунду.
+// Сборка и запуск: make bench_tree_pool
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+constexpr int kCount = 1000000;
+constexpr int kRounds = 5;
+
+template <typename Body>
+double Milliseconds(Body body) {
+  auto start = std::chrono::steady_clock::now();
+  body();
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+// Лучшее из kRounds время вставки и удаления всех keys
+template <template <typename, typename> class NodeAllocator>
+void Run(const char *name, const std::vector<int> &keys) {
+  using tree_type = s21::RBTree<int, std::less<int>, NodeAllocator>;
+  double insert_ms = 0;
+  double erase_ms = 0;
+  bool ok = true;
+  for (int round = 0; round < kRounds; ++round) {
+    tree_type tree;
+    double ms = Milliseconds([&] {
+      for (int key : keys) tree.UniqueInsert(key);
+    });
+    if (round == 0 || ms < insert_ms) insert_ms = ms;
+    ok = ok && tree._size_() == keys.size();
+    ms = Milliseconds([&] {
+      for (int key : keys) tree.Erase(tree.Find(key));
+    });
+    if (round == 0 || ms < erase_ms) erase_ms = ms;
+    ok = ok && tree._size_() == 0;
+  }
+  std::printf("%-18s insert %6.2f Mops/s  erase %6.2f Mops/s%s\n", name,
+              double(kCount) / insert_ms / 1e3,
+              double(kCount) / erase_ms / 1e3, ok ? "" : "  wrong size");
+}
+}  // namespace
+
+int main() {
+  std::vector<int> keys(kCount);
+  for (int i = 0; i < kCount; ++i) keys[i] = i;
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+  Run<s21::NodePool>("NodePool", keys);
+  Run<s21::NodeHeapAllocator>("NodeHeapAllocator", keys);
+  return 0;
+}
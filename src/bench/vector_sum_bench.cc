@@ -0,0 +1,67 @@
+// Замер суммирования s21::vector<float> через operator[] и через итераторы
+// в сравнении с std::vector<float>. Без S21_CHECKED_ITERATORS operator[]
+// ничего не проверяет, и цикл векторизуется так же, как для std::vector.
+// Сумма float векторизуется только с переупорядочиванием сложений, поэтому
+// цель собирается с -O3 -ffast-math -march=native, а -fopt-info-vec-optimized
+// печатает векторизованные циклы.
+// Сборка и запуск: make bench_vector_sum
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+constexpr std::size_t kSize = 1 << 16;
+constexpr int kRepeats = 20000;
+
+template <typename Body>
+double Milliseconds(Body body) {
+  auto start = std::chrono::steady_clock::now();
+  body();
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+template <typename Vector>
+float SumIndexed(const Vector &values) {
+  float sum = 0;
+  for (std::size_t i = 0; i < values.size(); ++i) sum += values[i];
+  return sum;
+}
+
+template <typename Vector>
+float SumIterated(const Vector &values) {
+  float sum = 0;
+  for (float value : values) sum += value;
+  return sum;
+}
+
+// Запись в начало вектора на каждом повторе не дает компилятору вынести
+// суммирование из цикла повторов
+template <typename Vector, typename Sum>
+void Run(const char *name, Vector &values, Sum sum) {
+  float total = 0;
+  double ms = Milliseconds([&] {
+    for (int i = 0; i < kRepeats; ++i) {
+      values[0] = float(i % 2);
+      total += sum(values);
+    }
+  });
+  std::printf("%-22s %6.2f Gflop/s  (sum %g)\n", name,
+              double(kSize) * kRepeats / ms / 1e6, double(total));
+}
+}  // namespace
+
+int main() {
+  s21::vector<float> values(kSize);
+  std::vector<float> std_values(kSize);
+  for (std::size_t i = 0; i < kSize; ++i)
+    values[i] = std_values[i] = float(i % 7) * 0.5f;
+  Run("s21::vector operator[]", values, SumIndexed<s21::vector<float>>);
+  Run("s21::vector iterators", values, SumIterated<s21::vector<float>>);
+  Run("std::vector operator[]", std_values, SumIndexed<std::vector<float>>);
+  Run("std::vector iterators", std_values, SumIterated<std::vector<float>>);
+  return 0;
+}
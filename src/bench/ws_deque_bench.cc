@@ -0,0 +1,164 @@
+// Замер масштабирования fork-join на деках s21::ws_deque: каждый рабочий
+// поток кладет подзадачи в свой дек и забирает их оттуда сам, свободные
+// потоки крадут задачи у случайной жертвы. Ожидающий подзадачу поток не
+// спит, а выполняет чужую работу(help-while-joining).
+// Две нагрузки: рекурсивное fib(36) - много мелких задач, и сумма вектора
+// из 2^25 элементов - мало крупных задач, упирающихся в память.
+// Сборка и запуск: make bench_ws_deque
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+struct Task {
+  void run() {
+    fn();
+    done.store(true, std::memory_order_release);
+  }
+
+  std::function<void()> fn;
+  std::atomic<bool> done{false};
+};
+
+class Pool {
+ public:
+  explicit Pool(int workers) : workers_(workers) {
+    for (int i = 0; i < workers; ++i)
+      deques_.push_back(std::make_unique<s21::ws_deque<Task *>>());
+  }
+
+  // Выполняет body в потоке 0, пока остальные потоки ищут работу
+  template <typename Body>
+  void run(Body body) {
+    stop_.store(false);
+    std::vector<std::thread> threads;
+    for (int i = 1; i < workers_; ++i) {
+      threads.emplace_back([this, i] {
+        self_ = i;
+        Task *task;
+        while (!stop_.load(std::memory_order_acquire)) {
+          if (find(task))
+            task->run();
+          else
+            std::this_thread::yield();
+        }
+      });
+    }
+    self_ = 0;
+    body();
+    stop_.store(true, std::memory_order_release);
+    for (std::thread &thread : threads) thread.join();
+  }
+
+  void spawn(Task &task) { deques_[self_]->push(&task); }
+
+  // Ждет task, выполняя тем временем свои и украденные задачи
+  void wait(Task &task) {
+    Task *other;
+    while (!task.done.load(std::memory_order_acquire)) {
+      if (find(other))
+        other->run();
+      else
+        std::this_thread::yield();
+    }
+  }
+
+ private:
+  bool find(Task *&task) {
+    if (deques_[self_]->pop(task)) return true;
+    static thread_local std::minstd_rand random(self_ + 1);
+    for (int attempt = 0; attempt < workers_; ++attempt) {
+      int victim = int(random() % unsigned(workers_));
+      if (victim != self_ && deques_[victim]->steal(task)) return true;
+    }
+    return false;
+  }
+
+  static thread_local int self_;
+  int workers_;
+  std::vector<std::unique_ptr<s21::ws_deque<Task *>>> deques_;
+  std::atomic<bool> stop_{false};
+};
+
+thread_local int Pool::self_ = 0;
+
+constexpr int kFibArgument = 36;
+constexpr int kFibCutoff = 20;
+constexpr long kSumLeaf = 1 << 15;
+
+Pool *pool = nullptr;
+const long *values = nullptr;
+
+long SerialFib(int n) {
+  return n < 2 ? n : SerialFib(n - 1) + SerialFib(n - 2);
+}
+
+long ParallelFib(int n) {
+  if (n < kFibCutoff) return SerialFib(n);
+  long left = 0;
+  Task child;
+  child.fn = [&left, n] { left = ParallelFib(n - 1); };
+  pool->spawn(child);
+  long right = ParallelFib(n - 2);
+  pool->wait(child);
+  return left + right;
+}
+
+long SerialSum(long first, long last) {
+  long sum = 0;
+  for (long i = first; i < last; ++i) sum += values[i];
+  return sum;
+}
+
+long ParallelSum(long first, long last) {
+  if (last - first < kSumLeaf) return SerialSum(first, last);
+  long middle = first + (last - first) / 2;
+  long left = 0;
+  Task child;
+  child.fn = [&left, first, middle] { left = ParallelSum(first, middle); };
+  pool->spawn(child);
+  long right = ParallelSum(middle, last);
+  pool->wait(child);
+  return left + right;
+}
+
+template <typename Body>
+double Milliseconds(Body body) {
+  auto start = std::chrono::steady_clock::now();
+  body();
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+}  // namespace
+
+int main() {
+  s21::vector<long> data(std::size_t(1) << 25);
+  for (std::size_t i = 0; i < data.size(); ++i) data[i] = long(i);
+  values = data.data();
+  long size = long(data.size());
+  // результаты копятся, чтобы компилятор не выбросил вычисления
+  long check = 0;
+  double fib_ms = Milliseconds([&] { check += SerialFib(kFibArgument); });
+  double sum_ms = Milliseconds([&] { check += SerialSum(0, size); });
+  std::printf("serial:     fib %7.1f ms  sum %7.1f ms\n", fib_ms, sum_ms);
+  for (int workers : {1, 2, 4, 8, 16}) {
+    Pool workers_pool(workers);
+    pool = &workers_pool;
+    workers_pool.run([&] {
+      fib_ms = Milliseconds([&] { check += ParallelFib(kFibArgument); });
+      sum_ms = Milliseconds([&] { check += ParallelSum(0, size); });
+    });
+    std::printf("%2d workers: fib %7.1f ms  sum %7.1f ms\n", workers, fib_ms,
+                sum_ms);
+  }
+  std::printf("checksum %ld\n", check);
+  return 0;
+}
@@ -0,0 +1,194 @@
+#ifndef S21_CONTAINERS_ITERATORS_S21_CHECKED_ITERATOR_H
+#define S21_CONTAINERS_ITERATORS_S21_CHECKED_ITERATOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+// Отладочный режим S21_CHECKED_ITERATORS: operator[] и итераторы контейнеров
+// проверяют границы, принадлежность контейнеру и недействительность, при
+// нарушении бросается std::out_of_range. Без макроса проверок нет вовсе.
+// Макрос должен быть одинаковым во всех единицах трансляции программы
+#ifdef S21_CHECKED_ITERATORS
+#define S21_ITERATOR_CHECK(condition, message)          \
+  do {                                                  \
+    if (!(condition)) throw std::out_of_range(message); \
+  } while (false)
+#else
+#define S21_ITERATOR_CHECK(condition, message) \
+  do {                                         \
+  } while (false)
+#endif
+
+namespace s21 {
+// Для noexcept функций, которые в режиме проверок могут бросить исключение
+#ifdef S21_CHECKED_ITERATORS
+inline constexpr bool kCheckedIterators = true;
+#else
+inline constexpr bool kCheckedIterators = false;
+#endif
+
+// Итератор непрерывного буфера контейнера Owner в режиме
+// S21_CHECKED_ITERATORS. Запоминает контейнер и его версию при создании:
+// контейнер увеличивает версию после операций, которые делают итераторы
+// недействительными. Owner дает data(), size() и IteratorVersion()
+template <typename T, typename Owner>
+class CheckedIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_const_t<T>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  CheckedIterator() noexcept = default;
+
+  CheckedIterator(pointer ptr, const Owner *owner) noexcept
+      : ptr_(ptr), owner_(owner), version_(owner->IteratorVersion()) {}
+
+  // неявное преобразование iterator в const_iterator
+  template <typename U,
+            typename = std::enable_if_t<std::is_same_v<const U, T> &&
+                                        !std::is_same_v<U, T>>>
+  CheckedIterator(const CheckedIterator<U, Owner> &other) noexcept
+      : ptr_(other.ptr_), owner_(other.owner_), version_(other.version_) {}
+
+  reference operator*() const {
+    CheckOffset(0, false);
+    return *ptr_;
+  }
+
+  pointer operator->() const {
+    CheckOffset(0, false);
+    return ptr_;
+  }
+
+  reference operator[](difference_type n) const {
+    CheckOffset(n, false);
+    return ptr_[n];
+  }
+
+  CheckedIterator &operator++() {
+    CheckOffset(1, true);
+    ++ptr_;
+    return *this;
+  }
+
+  CheckedIterator operator++(int) {
+    CheckedIterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  CheckedIterator &operator--() {
+    CheckOffset(-1, true);
+    --ptr_;
+    return *this;
+  }
+
+  CheckedIterator operator--(int) {
+    CheckedIterator tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  CheckedIterator &operator+=(difference_type n) {
+    CheckOffset(n, true);
+    ptr_ += n;
+    return *this;
+  }
+
+  CheckedIterator &operator-=(difference_type n) { return *this += -n; }
+
+  CheckedIterator operator+(difference_type n) const {
+    CheckedIterator tmp = *this;
+    return tmp += n;
+  }
+
+  friend CheckedIterator operator+(difference_type n,
+                                   const CheckedIterator &it) {
+    return it + n;
+  }
+
+  CheckedIterator operator-(difference_type n) const {
+    CheckedIterator tmp = *this;
+    return tmp -= n;
+  }
+
+  // Сравнения - дружественные функции, чтобы iterator неявно приводился к
+  // const_iterator с любой стороны
+  friend difference_type operator-(const CheckedIterator &lhs,
+                                   const CheckedIterator &rhs) {
+    lhs.CheckCompatible(rhs);
+    return lhs.ptr_ - rhs.ptr_;
+  }
+
+  friend bool operator==(const CheckedIterator &lhs,
+                         const CheckedIterator &rhs) {
+    lhs.CheckCompatible(rhs);
+    return lhs.ptr_ == rhs.ptr_;
+  }
+
+  friend bool operator!=(const CheckedIterator &lhs,
+                         const CheckedIterator &rhs) {
+    return !(lhs == rhs);
+  }
+
+  friend bool operator<(const CheckedIterator &lhs,
+                        const CheckedIterator &rhs) {
+    lhs.CheckCompatible(rhs);
+    return lhs.ptr_ < rhs.ptr_;
+  }
+
+  friend bool operator>(const CheckedIterator &lhs,
+                        const CheckedIterator &rhs) {
+    return rhs < lhs;
+  }
+
+  friend bool operator<=(const CheckedIterator &lhs,
+                         const CheckedIterator &rhs) {
+    return !(rhs < lhs);
+  }
+
+  friend bool operator>=(const CheckedIterator &lhs,
+                         const CheckedIterator &rhs) {
+    return !(lhs < rhs);
+  }
+
+  // Контейнер, которому принадлежит итератор
+  const Owner *owner() const noexcept { return owner_; }
+
+ private:
+  template <typename, typename>
+  friend class CheckedIterator;
+
+  void CheckValid() const {
+    if (owner_ == nullptr) throw std::out_of_range("iterator is singular");
+    if (owner_->IteratorVersion() != version_)
+      throw std::out_of_range("iterator is invalidated");
+  }
+
+  // ptr_ + n должен указывать на элемент(или на конец, если to_end)
+  void CheckOffset(difference_type n, bool to_end) const {
+    CheckValid();
+    difference_type pos = ptr_ - owner_->data() + n;
+    difference_type last = static_cast<difference_type>(owner_->size());
+    if (pos < 0 || pos > last || (!to_end && pos == last))
+      throw std::out_of_range("iterator is out of range");
+  }
+
+  void CheckCompatible(const CheckedIterator &other) const {
+    CheckValid();
+    other.CheckValid();
+    if (owner_ != other.owner_)
+      throw std::out_of_range("iterators of different containers");
+  }
+
+  pointer ptr_ = nullptr;
+  const Owner *owner_ = nullptr;
+  std::size_t version_ = 0;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_ITERATORS_S21_CHECKED_ITERATOR_H
@@ -4,69 +4,51 @@
 #include <stdexcept>
 
 #include "../s21_list_node.h"
+#include "s21_checked_iterator.h"
 
 namespace s21 {
 
 template <typename T>
 class ListIterator {
  public:
-  friend class list<T>;
+  template <typename, typename>
+  friend class list;
 
   ListIterator() {}
 
-  ListIterator(list<T> list) {
-    if (list.begin_ == nullptr) {
-      throw std::out_of_range("empty container");
-    }
-    node_ = list.begin_;
-  }
-
-  ListIterator(Node<T>* node) {
-    if (node == nullptr) {
-      throw std::out_of_range("empty container");
-    }
-    node_ = node;
+  ListIterator(ListNodeBase* node) : node_(node) {
+    S21_ITERATOR_CHECK(node != nullptr, "empty container");
   }
 
   ListIterator& operator++() {
-    if (node_->next_ != nullptr) {
-      node_ = node_->next_;
-    }
+    S21_ITERATOR_CHECK(node_->next_ != nullptr, "increment past end of list");
+    node_ = node_->next_;
     return *this;
   }
 
   ListIterator& operator--() {
-    if (node_->prev_ != nullptr) {
-      node_ = node_->prev_;
-    }
+    S21_ITERATOR_CHECK(node_->prev_ != nullptr, "decrement before begin");
+    node_ = node_->prev_;
     return *this;
   }
 
+  // У фиктивного узла end() нет следующего
   T& operator*() const {
-    if (node_ == nullptr) {
-      throw std::out_of_range("node don't excist");
-    }
-    return node_->value_;
+    S21_ITERATOR_CHECK(node_ != nullptr && node_->next_ != nullptr,
+                       "dereferencing end of list");
+    return static_cast<Node<T>*>(node_)->value_;
   }
 
-  bool operator==(const ListIterator& other) const {
-    if (this->node_ == nullptr || other.node_ == nullptr) {
-      throw std::out_of_range("node don't excist");
-    }
-    bool res = (this->node_ == other.node_) ? true : false;
-    return res;
+  bool operator==(const ListIterator& other) const noexcept {
+    return node_ == other.node_;
   }
 
-  bool operator!=(const ListIterator& other) const {
-    if (this->node_ == nullptr || other.node_ == nullptr) {
-      throw std::out_of_range("node don't excist");
-    }
-    bool res = (this->node_ != other.node_) ? true : false;
-    return res;
+  bool operator!=(const ListIterator& other) const noexcept {
+    return node_ != other.node_;
   }
 
  private:
-  Node<T>* node_;
+  ListNodeBase* node_;
 };
 
 }  // namespace s21
@@ -0,0 +1,72 @@
+#ifndef S21_CONTAINERS_S21_ALLOCATOR_H
+#define S21_CONTAINERS_S21_ALLOCATOR_H
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Аллокатор того же семейства для объектов типа U(например узлов)
+template <typename Allocator, typename U>
+using rebind_alloc_t =
+    typename std::allocator_traits<Allocator>::template rebind_alloc<U>;
+
+// Хранит аллокатор контейнера. Контейнер наследуется от хранилища, поэтому
+// пустой аллокатор(std::allocator) не увеличивает его размер
+template <typename Allocator, bool = std::is_empty_v<Allocator> &&
+                                     !std::is_final_v<Allocator>>
+class AllocatorStorage : private Allocator {
+ public:
+  AllocatorStorage() = default;
+
+  explicit AllocatorStorage(const Allocator &alloc) noexcept
+      : Allocator(alloc) {}
+
+  Allocator &allocator() noexcept { return *this; }
+
+  const Allocator &allocator() const noexcept { return *this; }
+};
+
+template <typename Allocator>
+class AllocatorStorage<Allocator, false> {
+ public:
+  AllocatorStorage() = default;
+
+  explicit AllocatorStorage(const Allocator &alloc) noexcept
+      : alloc_(alloc) {}
+
+  Allocator &allocator() noexcept { return alloc_; }
+
+  const Allocator &allocator() const noexcept { return alloc_; }
+
+ private:
+  Allocator alloc_;
+};
+
+// Правила std::allocator_traits для аллокатора контейнера при присваивании
+// и обмене. Аллокатор, который не распространяется(например
+// std::pmr::polymorphic_allocator), остается у своего контейнера - его
+// нельзя даже присвоить
+
+// Обменивает аллокаторы, если они участвуют в swap контейнеров
+template <typename Allocator>
+void PropagateOnSwap(Allocator &lhs, Allocator &rhs) noexcept {
+  using traits = std::allocator_traits<Allocator>;
+  if constexpr (traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(lhs, rhs);
+  }
+}
+
+// Можно ли при перемещающем присваивании просто забрать память источника,
+// не сравнивая аллокаторы
+template <typename Allocator>
+inline constexpr bool kMoveStealsMemory =
+    std::allocator_traits<Allocator>::propagate_on_container_move_assignment::
+        value ||
+    std::allocator_traits<Allocator>::is_always_equal::value;
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_ALLOCATOR_H
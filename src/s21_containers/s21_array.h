@@ -5,6 +5,8 @@
 #include <initializer_list>
 #include <stdexcept>
 
+#include "iterators/s21_checked_iterator.h"
+
 namespace s21 {
 template <typename T, std::size_t size_>
 
@@ -13,8 +15,15 @@ class array {
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+#ifdef S21_CHECKED_ITERATORS
+  using iterator = CheckedIterator<T, array>;
+  using const_iterator = CheckedIterator<const T, array>;
+#else
   using iterator = T *;
   using const_iterator = const T *;
+#endif
   using size_type = std::size_t;
 
  public:
@@ -68,9 +77,16 @@ class array {
     return arr_[ind];
   }
 
-  reference operator[](size_type ind) { return at(ind); }
+  // Без проверки границ(кроме режима S21_CHECKED_ITERATORS)
+  constexpr reference operator[](size_type ind) {
+    S21_ITERATOR_CHECK(ind < size_, "index out of range in array");
+    return arr_[ind];
+  }
 
-  const_reference operator[](size_type ind) const { return at(ind); }
+  constexpr const_reference operator[](size_type ind) const {
+    S21_ITERATOR_CHECK(ind < size_, "index out of range in array");
+    return arr_[ind];
+  }
 
   constexpr reference front() {
     if (size_ == 0) {
@@ -100,33 +116,31 @@ class array {
     return arr_[size_ - 1];
   }
 
-  constexpr iterator data() noexcept { return arr_; }
+  constexpr pointer data() noexcept { return arr_; }
 
-  constexpr const_iterator data() const noexcept { return arr_; }
+  constexpr const_pointer data() const noexcept { return arr_; }
 
   // iterators
  public:
-  constexpr iterator begin() noexcept { return arr_; }
+  constexpr iterator begin() noexcept { return makeIterator(arr_); }
 
-  constexpr const_iterator begin() const noexcept { return arr_; }
+  constexpr const_iterator begin() const noexcept {
+    return makeIterator(arr_);
+  }
 
-  constexpr iterator end() noexcept { return arr_ + size_; }
+  constexpr iterator end() noexcept { return makeIterator(arr_ + size_); }
 
-  constexpr const_iterator end() const noexcept { return arr_ + size_; }
+  constexpr const_iterator end() const noexcept {
+    return makeIterator(arr_ + size_);
+  }
 
   // Capacity
  public:
-  [[nodiscard]] constexpr size_type size() const noexcept {
-    return std::distance(begin(), end());
-  }
+  [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
 
-  [[nodiscard]] constexpr bool empty() const noexcept {
-    return end() == begin();
-  }
+  [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
 
-  [[nodiscard]] constexpr size_type max_size() const noexcept {
-    return std::distance(begin(), end());
-  }
+  [[nodiscard]] constexpr size_type max_size() const noexcept { return size_; }
 
  public:
   constexpr void swap(array &other) noexcept {
@@ -139,12 +153,36 @@ class array {
   }
 
   void fill(const_reference val) {
-    for (auto *start = begin(); start != end(); ++start) {
+    for (auto start = begin(); start != end(); ++start) {
       *start = val;
     }
   }
 
  private:
+  // Итераторы массива становятся недействительными только вместе с ним
+  constexpr size_type IteratorVersion() const noexcept { return 0; }
+
+  constexpr iterator makeIterator(pointer ptr) noexcept {
+#ifdef S21_CHECKED_ITERATORS
+    return iterator(ptr, this);
+#else
+    return ptr;
+#endif
+  }
+
+  constexpr const_iterator makeIterator(const_pointer ptr) const noexcept {
+#ifdef S21_CHECKED_ITERATORS
+    return const_iterator(ptr, this);
+#else
+    return ptr;
+#endif
+  }
+
+#ifdef S21_CHECKED_ITERATORS
+  friend iterator;
+  friend const_iterator;
+#endif
+
   value_type arr_[size_] = {};
 };
 }  // namespace s21
@@ -0,0 +1,724 @@
+#ifndef S21_CONTAINERS_S21_BTREE_H_
+#define S21_CONTAINERS_S21_BTREE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Ключ элемента множества - сам элемент
+template <typename Key>
+struct KeyIdentity {
+  const Key &operator()(const Key &value) const noexcept { return value; }
+};
+
+// Ключ элемента словаря - первый элемент пары
+template <typename Pair>
+struct KeyFirst {
+  const typename Pair::first_type &operator()(
+      const Pair &value) const noexcept {
+    return value.first;
+  }
+};
+
+// B+-дерево уникальных ключей. Элементы хранятся только в листьях, подряд по
+// несколько десятков в одном узле, листья связаны в двусвязный список, так
+// что обход идет последовательно по памяти. Внутренние узлы хранят только
+// копии ключей-разделителей и указатели на детей.
+// Key - тип ключа, Value - тип элемента, KeyOf - извлечение ключа из
+// элемента, Compare - порядок ключей(может быть прозрачным), NodeBytes -
+// примерный размер узла в байтах(от него зависит количество ключей в узле).
+// Разделитель keys[i] внутреннего узла не больше всех ключей поддерева
+// children[i + 1] и больше всех ключей поддерева children[i]. После удалений
+// разделитель может не совпадать ни с одним ключом, но остается верным
+template <typename Key, typename Value, typename KeyOf,
+          typename Compare = std::less<Key>, std::size_t NodeBytes = 256>
+class BPlusTree {
+ private:
+  struct Node;
+  struct Leaf;
+  struct Inner;
+  template <bool IsConst>
+  class LeafIterator;
+
+ public:
+  // Тип ключа
+  using key_type = Key;
+  // Тип элемента
+  using value_type = Value;
+  // Ссылка на элемент
+  using reference = value_type &;
+  // Константная ссылка на элемент
+  using const_reference = const value_type &;
+  // Тип размера контейнера
+  using size_type = std::size_t;
+  // Итераторы(по листьям)
+  using iterator = LeafIterator<false>;
+  using const_iterator = LeafIterator<true>;
+
+  // Количество элементов в листе и ключей во внутреннем узле
+  static constexpr size_type kLeafSlots =
+      std::max<size_type>(4, NodeBytes / sizeof(value_type));
+  static constexpr size_type kInnerSlots =
+      std::max<size_type>(4, NodeBytes / (sizeof(key_type) + sizeof(void *)));
+
+  // Пустое дерево не держит ни одного узла: корень-лист создается первой
+  // вставкой, поэтому конструктор, перенос и clear не выделяют память
+  BPlusTree() = default;
+
+  BPlusTree(const BPlusTree &other) : BPlusTree() {
+    cmp_ = other.cmp_;
+    for (const_reference value : other) Emplace(KeyOf()(value), value);
+  }
+
+  BPlusTree(BPlusTree &&other) noexcept : BPlusTree() { swap(other); }
+
+  BPlusTree &operator=(const BPlusTree &other) {
+    if (this != &other) {
+      BPlusTree tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  BPlusTree &operator=(BPlusTree &&other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~BPlusTree() { clear(); }
+
+  // У пустого дерева без узлов begin() и end() - итераторы без листа
+  iterator begin() noexcept { return iterator(first_, 0); }
+
+  const_iterator begin() const noexcept { return const_iterator(first_, 0); }
+
+  iterator end() noexcept {
+    if (last_ == nullptr) return iterator();
+    return iterator(last_, last_->count_);
+  }
+
+  const_iterator end() const noexcept {
+    return const_cast<BPlusTree *>(this)->end();
+  }
+
+  size_type Size() const noexcept { return size_; }
+
+  size_type MaxSize() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+  }
+
+  // Удаляет все элементы вместе со всеми узлами
+  void clear() noexcept {
+    if (root_ != nullptr) Destroy(root_, height_);
+    root_ = nullptr;
+    first_ = last_ = nullptr;
+    height_ = 0;
+    size_ = 0;
+  }
+
+  void swap(BPlusTree &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(first_, other.first_);
+    std::swap(last_, other.last_);
+    std::swap(height_, other.height_);
+    std::swap(size_, other.size_);
+    std::swap(cmp_, other.cmp_);
+  }
+
+  // Функции поиска принимают любой ключ K, который cmp_ умеет сравнивать с
+  // key_type в обе стороны
+
+  // Первый элемент с ключом, не меньшим key
+  template <typename K>
+  iterator LowerBound(const K &key) noexcept {
+    if (root_ == nullptr) return end();
+    Leaf *leaf = Descend(key, nullptr, nullptr);
+    return Normalize(leaf, LeafLower(leaf, key));
+  }
+
+  template <typename K>
+  const_iterator LowerBound(const K &key) const noexcept {
+    return const_cast<BPlusTree *>(this)->LowerBound(key);
+  }
+
+  // Первый элемент с ключом, большим key
+  template <typename K>
+  iterator UpperBound(const K &key) noexcept {
+    if (root_ == nullptr) return end();
+    Leaf *leaf = Descend(key, nullptr, nullptr);
+    return Normalize(leaf, LeafUpper(leaf, key));
+  }
+
+  template <typename K>
+  const_iterator UpperBound(const K &key) const noexcept {
+    return const_cast<BPlusTree *>(this)->UpperBound(key);
+  }
+
+  template <typename K>
+  iterator Find(const K &key) noexcept {
+    iterator res = LowerBound(key);
+    if (res == end() || cmp_(key, KeyOf()(*res))) return end();
+    return res;
+  }
+
+  template <typename K>
+  const_iterator Find(const K &key) const noexcept {
+    return const_cast<BPlusTree *>(this)->Find(key);
+  }
+
+  // Вставка элемента, созданного из args, если ключа key еще нет. key
+  // используется только для спуска, элемент создается лишь при вставке
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> Emplace(const K &key, Args &&...args) {
+    if (root_ == nullptr) {
+      first_ = last_ = new Leaf;
+      root_ = first_;
+    }
+    Path path;
+    size_type depth = 0;
+    Leaf *leaf = Descend(key, path, &depth);
+    size_type pos = LeafLower(leaf, key);
+    if (pos < leaf->count_ && !cmp_(key, KeyOf()(leaf->Values()[pos])))
+      return {iterator(leaf, pos), false};
+
+    if (leaf->count_ < kLeafSlots) {
+      InsertRaw(leaf->Values(), leaf->count_, pos,
+                std::forward<Args>(args)...);
+      ++leaf->count_;
+      ++size_;
+      return {iterator(leaf, pos), true};
+    }
+
+    // Лист полон - делим пополам. Все узлы, которые понадобятся при
+    // делении(новый лист и по одному внутреннему узлу на каждого полного
+    // предка), берутся заранее, поэтому после деления листа память уже не
+    // выделяется
+    std::unique_ptr<Leaf> right(new Leaf);
+    std::unique_ptr<Inner> spare[kMaxHeight + 1];
+    ReserveSplits(path, depth, spare);
+    // Вставка в конец последнего листа(заполнение по возрастанию) оставляет
+    // левый лист полным
+    size_type from = (leaf == last_ && pos == leaf->count_)
+                         ? leaf->count_
+                         : (leaf->count_ + 1) / 2;
+    MoveAppend(right->Values(), 0, leaf->Values() + from, leaf->count_ - from);
+    right->count_ = leaf->count_ - from;
+    leaf->count_ = from;
+
+    Leaf *target = leaf;
+    if (pos >= from) {
+      target = right.get();
+      pos -= from;
+    }
+    try {
+      InsertRaw(target->Values(), target->count_, pos,
+                std::forward<Args>(args)...);
+    } catch (...) {
+      UndoSplit(leaf, right.get());
+      throw;
+    }
+    ++target->count_;
+    // Разделитель - копия первого ключа правого листа. Его создание -
+    // последнее, что может бросить: тогда убираем вставленный элемент и
+    // склеиваем листья обратно
+    try {
+      InsertIntoParent(path, depth, key_type(KeyOf()(right->Values()[0])),
+                       right.get(), spare);
+    } catch (...) {
+      EraseRaw(target->Values(), target->count_, pos);
+      --target->count_;
+      UndoSplit(leaf, right.get());
+      throw;
+    }
+    LinkAfter(leaf, right.release());
+    ++size_;
+    return {iterator(target, pos), true};
+  }
+
+  // Удаляет элемент с ключом key, возвращает количество удаленных(0 или 1)
+  template <typename K>
+  size_type EraseKey(const K &key) {
+    if (root_ == nullptr) return 0;
+    Path path;
+    size_type depth = 0;
+    Leaf *leaf = Descend(key, path, &depth);
+    size_type pos = LeafLower(leaf, key);
+    if (pos == leaf->count_ || cmp_(key, KeyOf()(leaf->Values()[pos])))
+      return 0;
+    EraseRaw(leaf->Values(), leaf->count_, pos);
+    --leaf->count_;
+    --size_;
+    RebalanceLeaf(leaf, path, depth);
+    return 1;
+  }
+
+  // Удаляет элемент на позиции pos
+  void Erase(const_iterator pos) {
+    if (pos == end()) return;
+    // спуск за ключом восстанавливает путь от корня до листа pos
+    EraseKey(KeyOf()(*pos));
+  }
+
+  // Переносит из other элементы, ключей которых еще нет. В other остаются
+  // только совпавшие элементы
+  void Merge(BPlusTree &other) {
+    if (this == &other) return;
+    BPlusTree rest;
+    for (iterator it = other.begin(); it != other.end(); ++it) {
+      if (!Emplace(KeyOf()(*it), std::move(*it)).second)
+        rest.Emplace(KeyOf()(*it), std::move(*it));
+    }
+    other.swap(rest);
+  }
+
+  // Высота дерева(0 - корень является листом), для проверок
+  size_type Height() const noexcept { return height_; }
+
+ private:
+  // Верхняя граница высоты: в каждом внутреннем узле не меньше двух детей
+  static constexpr size_type kMaxHeight =
+      std::numeric_limits<size_type>::digits;
+  // Минимальное заполнение узлов вне корня
+  static constexpr size_type kLeafMin = kLeafSlots / 2;
+  static constexpr size_type kInnerMin = kInnerSlots / 2;
+
+  struct Node {
+    explicit Node(bool leaf) noexcept : leaf_(leaf) {}
+
+    bool leaf_;
+    size_type count_ = 0;
+  };
+
+  struct Leaf : Node {
+    Leaf() noexcept : Node(true) {}
+
+    value_type *Values() noexcept {
+      return reinterpret_cast<value_type *>(storage_);
+    }
+
+    const value_type *Values() const noexcept {
+      return reinterpret_cast<const value_type *>(storage_);
+    }
+
+    Leaf *prev_ = nullptr;
+    Leaf *next_ = nullptr;
+    alignas(value_type) unsigned char storage_[sizeof(value_type) *
+                                               kLeafSlots];
+  };
+
+  struct Inner : Node {
+    Inner() noexcept : Node(false) {}
+
+    key_type *Keys() noexcept { return reinterpret_cast<key_type *>(storage_); }
+
+    Node *children_[kInnerSlots + 1];
+    alignas(key_type) unsigned char storage_[sizeof(key_type) * kInnerSlots];
+  };
+
+  // Узел на пути от корня и номер ребенка, в которого спустились
+  struct PathEntry {
+    Inner *node;
+    size_type index;
+  };
+  using Path = PathEntry[kMaxHeight];
+
+  template <bool IsConst>
+  class LeafIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const Value *, Value *>;
+    using reference = std::conditional_t<IsConst, const Value &, Value &>;
+
+    LeafIterator() noexcept = default;
+
+    // обычный итератор приводится к константному
+    template <bool C = IsConst, typename = std::enable_if_t<C>>
+    LeafIterator(const LeafIterator<false> &other) noexcept
+        : leaf_(other.leaf_), pos_(other.pos_) {}
+
+    reference operator*() const noexcept { return leaf_->Values()[pos_]; }
+
+    pointer operator->() const noexcept { return leaf_->Values() + pos_; }
+
+    LeafIterator &operator++() noexcept {
+      if (++pos_ == leaf_->count_ && leaf_->next_ != nullptr) {
+        leaf_ = leaf_->next_;
+        pos_ = 0;
+      }
+      return *this;
+    }
+
+    LeafIterator operator++(int) noexcept {
+      LeafIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    LeafIterator &operator--() noexcept {
+      if (pos_ == 0) {
+        leaf_ = leaf_->prev_;
+        pos_ = leaf_->count_;
+      }
+      --pos_;
+      return *this;
+    }
+
+    LeafIterator operator--(int) noexcept {
+      LeafIterator tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    bool operator==(const LeafIterator &other) const noexcept {
+      return leaf_ == other.leaf_ && pos_ == other.pos_;
+    }
+
+    bool operator!=(const LeafIterator &other) const noexcept {
+      return !(*this == other);
+    }
+
+   private:
+    friend class BPlusTree;
+    friend class LeafIterator<true>;
+
+    LeafIterator(Leaf *leaf, size_type pos) noexcept
+        : leaf_(leaf), pos_(pos) {}
+
+    Leaf *leaf_ = nullptr;
+    size_type pos_ = 0;
+  };
+
+  // Позиция pos после последнего элемента листа - это начало следующего
+  iterator Normalize(Leaf *leaf, size_type pos) noexcept {
+    if (pos == leaf->count_ && leaf->next_ != nullptr)
+      return iterator(leaf->next_, 0);
+    return iterator(leaf, pos);
+  }
+
+  // Спуск к листу, который может содержать key. Если path задан, то в него
+  // записывается путь, а в depth - его длина
+  template <typename K>
+  Leaf *Descend(const K &key, PathEntry *path, size_type *depth) const {
+    Node *node = root_;
+    size_type level = 0;
+    while (!node->leaf_) {
+      Inner *inner = static_cast<Inner *>(node);
+      key_type *keys = inner->Keys();
+      // количество разделителей, не больших key
+      size_type index = static_cast<size_type>(
+          std::upper_bound(keys, keys + inner->count_, key,
+                           [this](const K &lhs, const key_type &rhs) {
+                             return cmp_(lhs, rhs);
+                           }) -
+          keys);
+      if (path != nullptr) path[level] = {inner, index};
+      ++level;
+      node = inner->children_[index];
+    }
+    if (depth != nullptr) *depth = level;
+    return static_cast<Leaf *>(node);
+  }
+
+  template <typename K>
+  size_type LeafLower(Leaf *leaf, const K &key) const {
+    const value_type *values = leaf->Values();
+    return static_cast<size_type>(
+        std::lower_bound(values, values + leaf->count_, key,
+                         [this](const value_type &lhs, const K &rhs) {
+                           return cmp_(KeyOf()(lhs), rhs);
+                         }) -
+        values);
+  }
+
+  template <typename K>
+  size_type LeafUpper(Leaf *leaf, const K &key) const {
+    const value_type *values = leaf->Values();
+    return static_cast<size_type>(
+        std::upper_bound(values, values + leaf->count_, key,
+                         [this](const K &lhs, const value_type &rhs) {
+                           return cmp_(lhs, KeyOf()(rhs));
+                         }) -
+        values);
+  }
+
+  // Берет в spare по внутреннему узлу на каждого полного предка листа на
+  // уровне depth и еще один под новый корень, если полны все предки
+  static void ReserveSplits(PathEntry *path, size_type depth,
+                            std::unique_ptr<Inner> *spare) {
+    while (depth > 0 && path[depth - 1].node->count_ == kInnerSlots) {
+      (spare++)->reset(new Inner);
+      --depth;
+    }
+    if (depth == 0) spare->reset(new Inner);
+  }
+
+  // Возвращает в leaf элементы правой половины right после неудачной
+  // вставки. right еще не связан со списком листьев
+  static void UndoSplit(Leaf *leaf, Leaf *right) {
+    MoveAppend(leaf->Values(), leaf->count_, right->Values(), right->count_);
+    leaf->count_ += right->count_;
+    right->count_ = 0;
+  }
+
+  // Вставляет разделитель key и правого соседа right над узлом, который
+  // был разделен на уровне depth. Полные предки делятся по цепочке, узлы
+  // для них берутся из spare(ReserveSplits), поэтому память не выделяется
+  void InsertIntoParent(PathEntry *path, size_type depth, key_type key,
+                        Node *right, std::unique_ptr<Inner> *spare) {
+    while (depth > 0) {
+      --depth;
+      Inner *parent = path[depth].node;
+      size_type index = path[depth].index;
+      if (parent->count_ < kInnerSlots) {
+        InsertChild(parent, index, std::move(key), right);
+        return;
+      }
+      // делим полный узел: средний ключ уходит наверх
+      size_type mid = kInnerSlots / 2;
+      Inner *sibling = (spare++)->release();
+      key_type up(std::move(parent->Keys()[mid]));
+      MoveAppend(sibling->Keys(), 0, parent->Keys() + mid + 1,
+                 parent->count_ - mid - 1);
+      parent->Keys()[mid].~key_type();
+      std::copy(parent->children_ + mid + 1,
+                parent->children_ + parent->count_ + 1, sibling->children_);
+      sibling->count_ = parent->count_ - mid - 1;
+      parent->count_ = mid;
+      if (index <= mid)
+        InsertChild(parent, index, std::move(key), right);
+      else
+        InsertChild(sibling, index - mid - 1, std::move(key), right);
+      key = std::move(up);
+      right = sibling;
+    }
+    // разделился корень - дерево растет вверх
+    Inner *root = spare->release();
+    new (root->Keys()) key_type(std::move(key));
+    root->children_[0] = root_;
+    root->children_[1] = right;
+    root->count_ = 1;
+    root_ = root;
+    ++height_;
+  }
+
+  // Вставляет разделитель key на место index и ребенка child справа от него
+  static void InsertChild(Inner *node, size_type index, key_type &&key,
+                          Node *child) {
+    InsertRaw(node->Keys(), node->count_, index, std::move(key));
+    std::copy_backward(node->children_ + index + 1,
+                       node->children_ + node->count_ + 1,
+                       node->children_ + node->count_ + 2);
+    node->children_[index + 1] = child;
+    ++node->count_;
+  }
+
+  // Удаляет разделитель key_index и ребенка child_index
+  static void EraseChild(Inner *node, size_type key_index,
+                         size_type child_index) {
+    EraseRaw(node->Keys(), node->count_, key_index);
+    std::copy(node->children_ + child_index + 1,
+              node->children_ + node->count_ + 1,
+              node->children_ + child_index);
+    --node->count_;
+  }
+
+  // Лист на уровне depth стал заполнен меньше минимума: берем элемент у
+  // соседа с тем же родителем или сливаемся с ним
+  void RebalanceLeaf(Leaf *leaf, PathEntry *path, size_type depth) {
+    if (depth == 0 || leaf->count_ >= kLeafMin) return;
+    Inner *parent = path[depth - 1].node;
+    size_type index = path[depth - 1].index;
+    if (index > 0) {
+      Leaf *left = static_cast<Leaf *>(parent->children_[index - 1]);
+      if (left->count_ > kLeafMin) {
+        InsertRaw(leaf->Values(), leaf->count_, 0,
+                  std::move(left->Values()[left->count_ - 1]));
+        ++leaf->count_;
+        EraseRaw(left->Values(), left->count_, left->count_ - 1);
+        --left->count_;
+        parent->Keys()[index - 1] = KeyOf()(leaf->Values()[0]);
+        return;
+      }
+      MoveAppend(left->Values(), left->count_, leaf->Values(), leaf->count_);
+      left->count_ += leaf->count_;
+      Unlink(leaf);
+      delete leaf;
+      EraseChild(parent, index - 1, index);
+    } else {
+      Leaf *right = static_cast<Leaf *>(parent->children_[1]);
+      if (right->count_ > kLeafMin) {
+        InsertRaw(leaf->Values(), leaf->count_, leaf->count_,
+                  std::move(right->Values()[0]));
+        ++leaf->count_;
+        EraseRaw(right->Values(), right->count_, 0);
+        --right->count_;
+        parent->Keys()[0] = KeyOf()(right->Values()[0]);
+        return;
+      }
+      MoveAppend(leaf->Values(), leaf->count_, right->Values(),
+                 right->count_);
+      leaf->count_ += right->count_;
+      Unlink(right);
+      delete right;
+      EraseChild(parent, 0, 1);
+    }
+    RebalanceInner(path, depth - 1);
+  }
+
+  // То же для внутреннего узла path[depth]: перенос через разделитель
+  // родителя(поворот) или слияние вместе с разделителем
+  void RebalanceInner(PathEntry *path, size_type depth) {
+    Inner *node = path[depth].node;
+    if (depth == 0) {
+      // у корня остался один ребенок - дерево становится ниже
+      if (node->count_ == 0) {
+        root_ = node->children_[0];
+        delete node;
+        --height_;
+      }
+      return;
+    }
+    if (node->count_ >= kInnerMin) return;
+    Inner *parent = path[depth - 1].node;
+    size_type index = path[depth - 1].index;
+    key_type *separators = parent->Keys();
+    if (index > 0) {
+      Inner *left = static_cast<Inner *>(parent->children_[index - 1]);
+      if (left->count_ > kInnerMin) {
+        // поворот вправо
+        InsertRaw(node->Keys(), node->count_, 0,
+                  std::move(separators[index - 1]));
+        std::copy_backward(node->children_, node->children_ + node->count_ + 1,
+                           node->children_ + node->count_ + 2);
+        node->children_[0] = left->children_[left->count_];
+        ++node->count_;
+        separators[index - 1] = std::move(left->Keys()[left->count_ - 1]);
+        EraseRaw(left->Keys(), left->count_, left->count_ - 1);
+        --left->count_;
+        return;
+      }
+      MergeInner(left, std::move(separators[index - 1]), node);
+      EraseChild(parent, index - 1, index);
+    } else {
+      Inner *right = static_cast<Inner *>(parent->children_[1]);
+      if (right->count_ > kInnerMin) {
+        // поворот влево
+        InsertRaw(node->Keys(), node->count_, node->count_,
+                  std::move(separators[0]));
+        node->children_[node->count_ + 1] = right->children_[0];
+        ++node->count_;
+        separators[0] = std::move(right->Keys()[0]);
+        EraseRaw(right->Keys(), right->count_, 0);
+        std::copy(right->children_ + 1, right->children_ + right->count_ + 1,
+                  right->children_);
+        --right->count_;
+        return;
+      }
+      MergeInner(node, std::move(separators[0]), right);
+      EraseChild(parent, 0, 1);
+    }
+    RebalanceInner(path, depth - 1);
+  }
+
+  // Переносит separator и все содержимое right в конец left, right удаляется
+  static void MergeInner(Inner *left, key_type &&separator, Inner *right) {
+    new (left->Keys() + left->count_) key_type(std::move(separator));
+    MoveAppend(left->Keys(), left->count_ + 1, right->Keys(), right->count_);
+    std::copy(right->children_, right->children_ + right->count_ + 1,
+              left->children_ + left->count_ + 1);
+    left->count_ += right->count_ + 1;
+    delete right;
+  }
+
+  void LinkAfter(Leaf *leaf, Leaf *next) noexcept {
+    next->prev_ = leaf;
+    next->next_ = leaf->next_;
+    if (leaf->next_ != nullptr)
+      leaf->next_->prev_ = next;
+    else
+      last_ = next;
+    leaf->next_ = next;
+  }
+
+  void Unlink(Leaf *leaf) noexcept {
+    if (leaf->prev_ != nullptr)
+      leaf->prev_->next_ = leaf->next_;
+    else
+      first_ = leaf->next_;
+    if (leaf->next_ != nullptr)
+      leaf->next_->prev_ = leaf->prev_;
+    else
+      last_ = leaf->prev_;
+  }
+
+  // Работа с сырыми массивами из count живых элементов
+
+  // Создает элемент из args на месте pos, сдвигая хвост вправо
+  template <typename T, typename... Args>
+  static void InsertRaw(T *data, size_type count, size_type pos,
+                        Args &&...args) {
+    if (pos == count) {
+      new (data + count) T(std::forward<Args>(args)...);
+      return;
+    }
+    T tmp(std::forward<Args>(args)...);
+    new (data + count) T(std::move(data[count - 1]));
+    std::move_backward(data + pos, data + count - 1, data + count);
+    data[pos] = std::move(tmp);
+  }
+
+  // Удаляет элемент pos, сдвигая хвост влево
+  template <typename T>
+  static void EraseRaw(T *data, size_type count, size_type pos) {
+    std::move(data + pos + 1, data + count, data + pos);
+    data[count - 1].~T();
+  }
+
+  // Перемещает count элементов из src в конец dst(после dst_count живых),
+  // в src элементы разрушаются
+  template <typename T>
+  static void MoveAppend(T *dst, size_type dst_count, T *src,
+                         size_type count) {
+    std::uninitialized_move(src, src + count, dst + dst_count);
+    std::destroy(src, src + count);
+  }
+
+  // Освобождает поддерево node высоты height
+  static void Destroy(Node *node, size_type height) noexcept {
+    if (height == 0) {
+      Leaf *leaf = static_cast<Leaf *>(node);
+      std::destroy(leaf->Values(), leaf->Values() + leaf->count_);
+      delete leaf;
+      return;
+    }
+    Inner *inner = static_cast<Inner *>(node);
+    for (size_type i = 0; i <= inner->count_; ++i)
+      Destroy(inner->children_[i], height - 1);
+    std::destroy(inner->Keys(), inner->Keys() + inner->count_);
+    delete inner;
+  }
+
+  Node *root_ = nullptr;
+  Leaf *first_ = nullptr;
+  Leaf *last_ = nullptr;
+  size_type height_ = 0;
+  size_type size_ = 0;
+  Compare cmp_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_BTREE_H_
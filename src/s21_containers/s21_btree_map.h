@@ -0,0 +1,236 @@
+#ifndef S21_CONTAINERS_S21_BTREE_MAP_H_
+#define S21_CONTAINERS_S21_BTREE_MAP_H_
+
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+
+#include "s21_btree.h"
+#include "s21_tree.h"
+
+namespace s21 {
+// Словарь на B+-дереве: тот же интерфейс, что у s21::map, но пары хранятся
+// подряд в узлах размером около NodeBytes байт. Итераторы и ссылки на
+// значения становятся недействительными после любой вставки или удаления
+template <class Key, class Type, class Compare = std::less<Key>,
+          std::size_t NodeBytes = 256>
+class btree_map {
+ public:
+  // Тим элемента-ключ
+  using key_type = Key;
+  // Значение элемента
+  using mapped_type = Type;
+  // пара ключ и значение
+  using value_type = std::pair<Key, Type>;
+  // Ссылка на элемент
+  using reference = value_type &;
+  // Константная ссылка на элемент
+  using const_reference = const value_type &;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  // Внутренние классы
+  //  1)дерева
+  using tree_type =
+      BPlusTree<key_type, value_type, KeyFirst<value_type>, Compare, NodeBytes>;
+  // 2)итератор
+  using iterator = typename tree_type::iterator;
+  // 3)константный итератор
+  using const_iterator = typename tree_type::const_iterator;
+
+  // конструктор по умолчанию
+  btree_map() = default;
+
+  // конструктор из std::initializer_list
+  btree_map(std::initializer_list<value_type> const &items)
+      : btree_map(items.begin(), items.end()) {}
+
+  // конструктор из диапазона [first, last)(повторы ключей отбрасываются)
+  template <typename InputIt>
+  btree_map(InputIt first, InputIt last) : btree_map() {
+    for (; first != last; ++first) insert(*first);
+  }
+
+  // конструктор копирования
+  btree_map(const btree_map &other) : tree_(other.tree_) {}
+
+  // конструктор переноса
+  btree_map(btree_map &&other) noexcept : tree_(std::move(other.tree_)) {}
+
+  // оператор присваивания копированием
+  btree_map &operator=(const btree_map &other) {
+    tree_ = other.tree_;
+    return *this;
+  }
+
+  // оператор присваивания переносом
+  btree_map &operator=(btree_map &&other) noexcept {
+    tree_ = std::move(other.tree_);
+    return *this;
+  }
+
+  // Доступ к значению по ключу. Если такого элемента нет-вызывается
+  // исключение std::out_of_range
+  mapped_type &at(const key_type &key) {
+    iterator res = tree_.Find(key);
+    if (res == end()) throw std::out_of_range("No elements with key");
+    return res->second;
+  }
+
+  // const версия at()
+  const mapped_type &at(const key_type &key) const {
+    return const_cast<btree_map *>(this)->at(key);
+  }
+
+  // Возвращает ссылку на значение с ключом key. Если такого элемента нет,
+  // то выполняется вставка(значение создается по умолчанию)
+  mapped_type &operator[](const key_type &key) {
+    return try_emplace(key).first->second;
+  }
+
+  // Вставляет пару(key, mapped_type(args...)), если ключа key еще нет.
+  // Значение создается только при вставке
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return tree_.Emplace(key, std::piecewise_construct,
+                          std::forward_as_tuple(key),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  // возвращает итератор в начало контейнера
+  iterator begin() noexcept { return tree_.begin(); }
+
+  // тот же begin только для const
+  const_iterator begin() const noexcept { return tree_.begin(); }
+
+  // возвращает итератор на конец контейнера(после последнего элемента)
+  iterator end() noexcept { return tree_.end(); }
+
+  // const версия для end()
+  const_iterator end() const noexcept { return tree_.end(); }
+
+  // Возвращает кол-во элементов контейнера
+  size_type size() const noexcept { return tree_.Size(); }
+
+  // Возвращает true если контейнер пустой, false если нет
+  bool empty() const noexcept { return tree_.Size() == 0; }
+
+  // Возвращает максимально допустимое кол-во элементов в контейнере
+  size_type max_size() const noexcept { return tree_.MaxSize(); }
+
+  // очистка содержимого контейнера
+  void clear() noexcept { tree_.clear(); }
+
+  // удаляет элемент по передаваемой позиции pos
+  void erase(iterator pos) { tree_.Erase(pos); }
+
+  // Обменивает содержимое контейнера с other
+  void swap(btree_map &other) noexcept { tree_.swap(other.tree_); }
+
+  // Переносит из other пары, ключей которых еще нет в контейнере
+  void merge(btree_map &other) { tree_.Merge(other.tree_); }
+
+  // Вставка пары, если ключа value.first еще нет
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree_.Emplace(value.first, value);
+  }
+
+  // Вставка пары(key, obj), если ключа key еще нет
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return tree_.Emplace(key, key, obj);
+  }
+
+  // Присваивает obj значению с ключом key или вставляет новую пару
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const key_type &key, M &&obj) {
+    std::pair<iterator, bool> res = try_emplace(key, std::forward<M>(obj));
+    if (!res.second) res.first->second = std::forward<M>(obj);
+    return res;
+  }
+
+  // Находит пару с ключом key
+  iterator find(const key_type &key) noexcept { return tree_.Find(key); }
+
+  // const версия для find()
+  const_iterator find(const key_type &key) const noexcept {
+    return tree_.Find(key);
+  }
+
+  // Проверка на пару с ключом key(true-да,false-нет)
+  bool contains(const key_type &key) const noexcept {
+    return tree_.Find(key) != tree_.end();
+  }
+
+  // Количество пар с ключом key(0 или 1)
+  size_type count(const key_type &key) const noexcept {
+    return contains(key) ? 1 : 0;
+  }
+
+  // Итератор на первый пару с ключом, не меньшим key
+  iterator lower_bound(const key_type &key) noexcept {
+    return tree_.LowerBound(key);
+  }
+
+  // const версия lower_bound()
+  const_iterator lower_bound(const key_type &key) const noexcept {
+    return tree_.LowerBound(key);
+  }
+
+  // Итератор на первый пару с ключом, большим key
+  iterator upper_bound(const key_type &key) noexcept {
+    return tree_.UpperBound(key);
+  }
+
+  // const версия upper_bound()
+  const_iterator upper_bound(const key_type &key) const noexcept {
+    return tree_.UpperBound(key);
+  }
+
+  // Версии для ключа K при прозрачном Compare
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  iterator find(const K &key) noexcept {
+    return tree_.Find(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator find(const K &key) const noexcept {
+    return tree_.Find(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  bool contains(const K &key) const noexcept {
+    return tree_.Find(key) != tree_.end();
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  size_type count(const K &key) const noexcept {
+    return contains(key) ? 1 : 0;
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  iterator lower_bound(const K &key) noexcept {
+    return tree_.LowerBound(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator lower_bound(const K &key) const noexcept {
+    return tree_.LowerBound(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  iterator upper_bound(const K &key) noexcept {
+    return tree_.UpperBound(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator upper_bound(const K &key) const noexcept {
+    return tree_.UpperBound(key);
+  }
+
+ private:
+  tree_type tree_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_BTREE_MAP_H_
@@ -0,0 +1,196 @@
+#ifndef S21_CONTAINERS_S21_BTREE_SET_H_
+#define S21_CONTAINERS_S21_BTREE_SET_H_
+
+#include <initializer_list>
+
+#include "s21_btree.h"
+#include "s21_tree.h"
+
+namespace s21 {
+// Множество на B+-дереве: тот же интерфейс, что у s21::set, но ключи хранятся
+// подряд в узлах размером около NodeBytes байт. Для мелких ключей памяти
+// нужно в разы меньше, чем на узел красно-черного дерева, а обход идет
+// последовательно по памяти. Итераторы становятся недействительными после
+// любой вставки или удаления
+template <class Key, class Compare = std::less<Key>,
+          std::size_t NodeBytes = 256>
+class btree_set {
+ public:
+  // Тип элемента-ключ
+  using key_type = Key;
+  // Значение элемента
+  using value_type = key_type;
+  // Ссылка на элемент
+  using reference = value_type &;
+  // Константная ссылка на элемент
+  using const_reference = const value_type &;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  // Внутренние классы
+  //  1)дерева
+  using tree_type =
+      BPlusTree<key_type, value_type, KeyIdentity<Key>, Compare, NodeBytes>;
+  // 2)итераторы(элементы множества менять нельзя)
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+
+  // конструктор по умолчанию
+  btree_set() = default;
+
+  // конструктор из std::initializer_list
+  btree_set(std::initializer_list<value_type> const &items)
+      : btree_set(items.begin(), items.end()) {}
+
+  // конструктор из диапазона [first, last)(повторы ключей отбрасываются)
+  template <typename InputIt>
+  btree_set(InputIt first, InputIt last) : btree_set() {
+    for (; first != last; ++first) insert(*first);
+  }
+
+  // конструктор копирования
+  btree_set(const btree_set &other) : tree_(other.tree_) {}
+
+  // конструктор переноса
+  btree_set(btree_set &&other) noexcept : tree_(std::move(other.tree_)) {}
+
+  // оператор присваивания копированием
+  btree_set &operator=(const btree_set &other) {
+    tree_ = other.tree_;
+    return *this;
+  }
+
+  // оператор присваивания переносом
+  btree_set &operator=(btree_set &&other) noexcept {
+    tree_ = std::move(other.tree_);
+    return *this;
+  }
+
+  // возвращает итератор в начало контейнера
+  iterator begin() noexcept { return tree_.begin(); }
+
+  // тот же begin только для const
+  const_iterator begin() const noexcept { return tree_.begin(); }
+
+  // возвращает итератор на конец контейнера(после последнего элемента)
+  iterator end() noexcept { return tree_.end(); }
+
+  // const версия для end()
+  const_iterator end() const noexcept { return tree_.end(); }
+
+  // Возвращает кол-во элементов контейнера
+  size_type size() const noexcept { return tree_.Size(); }
+
+  // Возвращает true если контейнер пустой, false если нет
+  bool empty() const noexcept { return tree_.Size() == 0; }
+
+  // Возвращает максимально допустимое кол-во элементов в контейнере
+  size_type max_size() const noexcept { return tree_.MaxSize(); }
+
+  // очистка содержимого контейнера
+  void clear() noexcept { tree_.clear(); }
+
+  // удаляет элемент по передаваемой позиции pos
+  void erase(iterator pos) { tree_.Erase(pos); }
+
+  // Обменивает содержимое контейнера с other
+  void swap(btree_set &other) noexcept { tree_.swap(other.tree_); }
+
+  // Переносит из other элементы, ключей которых еще нет в контейнере
+  void merge(btree_set &other) { tree_.Merge(other.tree_); }
+
+  // Вставка элемента в контейнер, если такого ключа в контейнере нет
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree_.Emplace(value, value);
+  }
+
+  // rvalue версия insert()
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return tree_.Emplace(value, std::move(value));
+  }
+
+  // Находит элемент с ключом key
+  iterator find(const key_type &key) noexcept { return tree_.Find(key); }
+
+  // const версия для find()
+  const_iterator find(const key_type &key) const noexcept {
+    return tree_.Find(key);
+  }
+
+  // Проверка на элемент с ключом key(true-да,false-нет)
+  bool contains(const key_type &key) const noexcept {
+    return tree_.Find(key) != tree_.end();
+  }
+
+  // Количество элементов с ключом key(0 или 1)
+  size_type count(const key_type &key) const noexcept {
+    return contains(key) ? 1 : 0;
+  }
+
+  // Итератор на первый элемент с ключом, не меньшим key
+  iterator lower_bound(const key_type &key) noexcept {
+    return tree_.LowerBound(key);
+  }
+
+  // const версия lower_bound()
+  const_iterator lower_bound(const key_type &key) const noexcept {
+    return tree_.LowerBound(key);
+  }
+
+  // Итератор на первый элемент с ключом, большим key
+  iterator upper_bound(const key_type &key) noexcept {
+    return tree_.UpperBound(key);
+  }
+
+  // const версия upper_bound()
+  const_iterator upper_bound(const key_type &key) const noexcept {
+    return tree_.UpperBound(key);
+  }
+
+  // Версии для ключа K при прозрачном Compare
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  iterator find(const K &key) noexcept {
+    return tree_.Find(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator find(const K &key) const noexcept {
+    return tree_.Find(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  bool contains(const K &key) const noexcept {
+    return tree_.Find(key) != tree_.end();
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  size_type count(const K &key) const noexcept {
+    return contains(key) ? 1 : 0;
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  iterator lower_bound(const K &key) noexcept {
+    return tree_.LowerBound(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator lower_bound(const K &key) const noexcept {
+    return tree_.LowerBound(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  iterator upper_bound(const K &key) noexcept {
+    return tree_.UpperBound(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator upper_bound(const K &key) const noexcept {
+    return tree_.UpperBound(key);
+  }
+
+ private:
+  tree_type tree_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_BTREE_SET_H_
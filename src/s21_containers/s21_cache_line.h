@@ -0,0 +1,15 @@
+#ifndef S21_CONTAINERS_S21_CACHE_LINE_H_
+#define S21_CONTAINERS_S21_CACHE_LINE_H_
+#include <cstddef>
+
+namespace s21 {
+// Размер линии кэша для разнесения данных разных потоков. Переменные,
+// которые пишут разные потоки, выравниваются на него, чтобы запись одного
+// потока не выбивала линию из кэша другого(false sharing).
+// std::hardware_destructive_interference_size не используется: g++
+// предупреждает, что его значение зависит от -mtune, а размер объектов в
+// заголовке должен быть одинаковым во всех единицах трансляции
+inline constexpr std::size_t kCacheLineSize = 64;
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CACHE_LINE_H_
@@ -0,0 +1,224 @@
+#ifndef S21_CONTAINERS_S21_EYTZINGER_H_
+#define S21_CONTAINERS_S21_EYTZINGER_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Отсортированные элементы в порядке Эйтцингера(обход дерева в ширину):
+// корень неявного дерева поиска лежит в позиции 1, дети позиции k - в 2k и
+// 2k + 1(в памяти позиция k хранится в data_[k - 1]). Первые уровни дерева,
+// по которым проходит каждый поиск, лежат рядом в одном буфере, а спуск
+// идет без ветвлений по результату сравнения и с предзагрузкой узлов на
+// несколько уровней вперед. Структура только для чтения: после построения
+// элементы не добавляются и не удаляются.
+// Compare должен уметь сравнивать элементы с искомыми ключами в обе
+// стороны(как компаратор RBTree)
+template <typename Value, typename Compare>
+class EytzingerArray {
+ public:
+  using value_type = Value;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  // Итератор обходит элементы по возрастанию: переход к следующему
+  // элементу - это переход к следующему узлу неявного дерева(позиция 0 -
+  // конец)
+  class ConstIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    ConstIterator() noexcept = default;
+
+    reference operator*() const noexcept { return data_[pos_ - 1]; }
+
+    pointer operator->() const noexcept { return data_ + pos_ - 1; }
+
+    ConstIterator &operator++() noexcept {
+      if (2 * pos_ + 1 <= size_) {
+        // минимум правого поддерева
+        pos_ = 2 * pos_ + 1;
+        while (2 * pos_ <= size_) pos_ *= 2;
+      } else {
+        // поднимаемся, пока приходим из правого ребенка, затем еще раз
+        while (pos_ & 1U) pos_ >>= 1;
+        pos_ >>= 1;
+      }
+      return *this;
+    }
+
+    ConstIterator operator++(int) noexcept {
+      ConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    ConstIterator &operator--() noexcept {
+      if (pos_ == 0) {
+        // из end() в максимум всего дерева
+        pos_ = Rightmost(1);
+      } else if (2 * pos_ <= size_) {
+        // максимум левого поддерева
+        pos_ = Rightmost(2 * pos_);
+      } else {
+        while (pos_ != 1 && (pos_ & 1U) == 0) pos_ >>= 1;
+        pos_ >>= 1;
+      }
+      return *this;
+    }
+
+    ConstIterator operator--(int) noexcept {
+      ConstIterator tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    bool operator==(const ConstIterator &other) const noexcept {
+      return pos_ == other.pos_;
+    }
+
+    bool operator!=(const ConstIterator &other) const noexcept {
+      return pos_ != other.pos_;
+    }
+
+   private:
+    friend class EytzingerArray;
+
+    ConstIterator(const value_type *data, size_type size,
+                  size_type pos) noexcept
+        : data_(data), size_(size), pos_(pos) {}
+
+    size_type Rightmost(size_type pos) const noexcept {
+      while (2 * pos + 1 <= size_) pos = 2 * pos + 1;
+      return pos;
+    }
+
+    const value_type *data_ = nullptr;
+    size_type size_ = 0;
+    size_type pos_ = 0;
+  };
+
+  using const_iterator = ConstIterator;
+
+  EytzingerArray() = default;
+
+  explicit EytzingerArray(const Compare &cmp) : cmp_(cmp) {}
+
+  // Строит раскладку из отсортированного(по cmp_) диапазона. Берутся
+  // только адреса элементов, сами элементы копируются по одному разу
+  template <typename ForwardIt>
+  void AssignSorted(ForwardIt first, ForwardIt last) {
+    std::vector<const value_type *> sorted;
+    for (; first != last; ++first) sorted.push_back(&*first);
+    Build(sorted.size(), [&sorted](size_type i) -> const value_type & {
+      return *sorted[i];
+    });
+  }
+
+  // Произвольный диапазон: сортировка и удаление эквивалентных элементов
+  // (остается первый из них), затем раскладка с перемещением элементов
+  template <typename InputIt>
+  void AssignRange(InputIt first, InputIt last) {
+    std::vector<value_type> sorted(first, last);
+    std::stable_sort(sorted.begin(), sorted.end(), cmp_);
+    sorted.erase(std::unique(sorted.begin(), sorted.end(),
+                             [this](const_reference lhs, const_reference rhs) {
+                               return !cmp_(lhs, rhs);
+                             }),
+                 sorted.end());
+    Build(sorted.size(), [&sorted](size_type i) -> value_type && {
+      return std::move(sorted[i]);
+    });
+  }
+
+  const_iterator Begin() const noexcept { return Iterator(Leftmost(Size())); }
+
+  const_iterator End() const noexcept { return Iterator(0); }
+
+  size_type Size() const noexcept { return data_.size(); }
+
+  // Первый элемент, не меньший key
+  template <typename K>
+  const_iterator LowerBound(const K &key) const noexcept {
+    return Iterator(Descend([this, &key](const_reference elem) {
+      return cmp_(elem, key);
+    }));
+  }
+
+  // Первый элемент, больший key
+  template <typename K>
+  const_iterator UpperBound(const K &key) const noexcept {
+    return Iterator(Descend([this, &key](const_reference elem) {
+      return !cmp_(key, elem);
+    }));
+  }
+
+  template <typename K>
+  const_iterator Find(const K &key) const noexcept {
+    const_iterator res = LowerBound(key);
+    if (res == End() || cmp_(key, *res)) return End();
+    return res;
+  }
+
+ private:
+  // Через столько уровней вперед предзагружаются узлы: на уровне через 4
+  // от позиции k лежат 16 соседних потомков k(одна-две кэш-линии)
+  static constexpr size_type kPrefetchLevels = 4;
+
+  // Позиция минимума в дереве из size узлов
+  static size_type Leftmost(size_type size) noexcept {
+    size_type pos = size == 0 ? 0 : 1;
+    while (pos != 0 && 2 * pos <= size) pos *= 2;
+    return pos;
+  }
+
+  const_iterator Iterator(size_type pos) const noexcept {
+    return const_iterator(data_.data(), Size(), pos);
+  }
+
+  // Заполняет data_ так, что в позиции k лежит элемент с номером,
+  // равным номеру позиции k при симметричном обходе неявного дерева
+  template <typename Source>
+  void Build(size_type size, Source source) {
+    std::vector<size_type> order(size);
+    const_iterator it(nullptr, size, Leftmost(size));
+    for (size_type i = 0; i < size; ++i, ++it) order[it.pos_ - 1] = i;
+    std::vector<value_type> data;
+    data.reserve(size);
+    for (size_type i = 0; i < size; ++i) data.push_back(source(order[i]));
+    data_.swap(data);
+  }
+
+  // Спуск от корня: go_right(elem) - искомая граница правее elem. Сравнение
+  // превращается в номер ребенка без ветвления. В конце спуска позиция
+  // содержит путь; сброс хвостовых единиц(поворотов направо) и еще одного
+  // бита дает последний узел, где спуск ушел налево, - это и есть ответ
+  template <typename GoRight>
+  size_type Descend(GoRight go_right) const noexcept {
+    const value_type *data = data_.data();
+    const size_type size = Size();
+    size_type pos = 1;
+    while (pos <= size) {
+      size_type ahead = pos << kPrefetchLevels;
+      if (ahead <= size) __builtin_prefetch(data + ahead - 1);
+      pos = 2 * pos + static_cast<size_type>(go_right(data[pos - 1]));
+    }
+    while (pos & 1U) pos >>= 1;
+    return pos >> 1;
+  }
+
+  std::vector<value_type> data_;
+  Compare cmp_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_EYTZINGER_H_
@@ -0,0 +1,134 @@
+#ifndef S21_CONTAINERS_S21_FROZEN_MAP_H_
+#define S21_CONTAINERS_S21_FROZEN_MAP_H_
+
+#include <initializer_list>
+#include <stdexcept>
+
+#include "s21_eytzinger.h"
+#include "s21_map.h"
+
+namespace s21 {
+// Замороженный словарь: снимок s21::map(или любого диапазона пар) только для
+// чтения. Пары лежат одним непрерывным буфером в порядке Эйтцингера, поиск
+// по ключу не ходит по указателям. Вставки, удаления и изменение значений
+// не поддерживаются
+template <class Key, class Type, class Compare = std::less<Key>>
+class frozen_map {
+ public:
+  // Тип элемента-ключ
+  using key_type = Key;
+  // Значение элемента
+  using mapped_type = Type;
+  // пара ключ и значение
+  using value_type = std::pair<Key, Type>;
+  // Константная ссылка на элемент
+  using const_reference = const value_type &;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  // Компаратор пар по ключу(тот же, что у s21::map, поэтому поиск идет по
+  // голому ключу)
+  using value_compare = typename map<Key, Type, Compare>::MapCmprt;
+  // Внутренний класс раскладки
+  using layout_type = EytzingerArray<value_type, value_compare>;
+  // Итераторы только константные
+  using const_iterator = typename layout_type::const_iterator;
+  using iterator = const_iterator;
+
+  // пустой словарь
+  frozen_map() = default;
+
+  // снимок словаря m(m не меняется). Пары в m уже упорядочены по ключу,
+  // поэтому сортировки нет
+  template <class Statistic>
+  explicit frozen_map(const map<Key, Type, Compare, Statistic> &m) {
+    layout_.AssignSorted(m.begin(), m.end());
+  }
+
+  // словарь из произвольного диапазона пар(при повторе ключа остается
+  // первая пара)
+  template <typename InputIt>
+  frozen_map(InputIt first, InputIt last) {
+    layout_.AssignRange(first, last);
+  }
+
+  frozen_map(std::initializer_list<value_type> const &items)
+      : frozen_map(items.begin(), items.end()) {}
+
+  // возвращает итератор на пару с наименьшим ключом
+  const_iterator begin() const noexcept { return layout_.Begin(); }
+
+  // возвращает итератор на конец контейнера(после последнего элемента)
+  const_iterator end() const noexcept { return layout_.End(); }
+
+  // Возвращает кол-во элементов контейнера
+  size_type size() const noexcept { return layout_.Size(); }
+
+  // Возвращает true если контейнер пустой, false если нет
+  bool empty() const noexcept { return layout_.Size() == 0; }
+
+  // Доступ к значению по ключу. Если такого ключа нет-вызывается исключение
+  // std::out_of_range
+  const mapped_type &at(const key_type &key) const {
+    const_iterator res = layout_.Find(key);
+    if (res == end()) throw std::out_of_range("No elements with key");
+    return res->second;
+  }
+
+  // Находит пару с ключом key
+  const_iterator find(const key_type &key) const noexcept {
+    return layout_.Find(key);
+  }
+
+  // Проверка на элемент с ключом key(true-да,false-нет)
+  bool contains(const key_type &key) const noexcept {
+    return layout_.Find(key) != layout_.End();
+  }
+
+  // Количество пар с ключом key(0 или 1)
+  size_type count(const key_type &key) const noexcept {
+    return contains(key) ? 1 : 0;
+  }
+
+  // Итератор на первую пару с ключом, не меньшим key
+  const_iterator lower_bound(const key_type &key) const noexcept {
+    return layout_.LowerBound(key);
+  }
+
+  // Итератор на первую пару с ключом, большим key
+  const_iterator upper_bound(const key_type &key) const noexcept {
+    return layout_.UpperBound(key);
+  }
+
+  // Версии для ключа K при прозрачном Compare
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator find(const K &key) const noexcept {
+    return layout_.Find(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  bool contains(const K &key) const noexcept {
+    return layout_.Find(key) != layout_.End();
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  size_type count(const K &key) const noexcept {
+    return contains(key) ? 1 : 0;
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator lower_bound(const K &key) const noexcept {
+    return layout_.LowerBound(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator upper_bound(const K &key) const noexcept {
+    return layout_.UpperBound(key);
+  }
+
+ private:
+  layout_type layout_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_FROZEN_MAP_H_
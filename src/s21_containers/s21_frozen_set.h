@@ -0,0 +1,119 @@
+#ifndef S21_CONTAINERS_S21_FROZEN_SET_H_
+#define S21_CONTAINERS_S21_FROZEN_SET_H_
+
+#include <initializer_list>
+
+#include "s21_eytzinger.h"
+#include "s21_set.h"
+
+namespace s21 {
+// Замороженное множество: снимок s21::set(или любого диапазона) только для
+// чтения. Ключи лежат одним непрерывным буфером в порядке Эйтцингера, поэтому
+// поиск на больших множествах заметно быстрее, чем у дерева на указателях.
+// Вставки и удаления не поддерживаются
+template <class Key, class Compare = std::less<Key>>
+class frozen_set {
+ public:
+  // Тип элемента-ключ
+  using key_type = Key;
+  // Значение элемента
+  using value_type = key_type;
+  // Константная ссылка на элемент
+  using const_reference = const value_type &;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  // Внутренний класс раскладки
+  using layout_type = EytzingerArray<value_type, Compare>;
+  // Итераторы только константные
+  using const_iterator = typename layout_type::const_iterator;
+  using iterator = const_iterator;
+
+  // пустое множество
+  frozen_set() = default;
+
+  // снимок множества s(s не меняется). Ключи в s уже упорядочены, поэтому
+  // сортировки нет
+  template <class Statistic>
+  explicit frozen_set(const set<Key, Compare, Statistic> &s) {
+    layout_.AssignSorted(s.begin(), s.end());
+  }
+
+  // множество из произвольного диапазона(повторы отбрасываются)
+  template <typename InputIt>
+  frozen_set(InputIt first, InputIt last) {
+    layout_.AssignRange(first, last);
+  }
+
+  frozen_set(std::initializer_list<value_type> const &items)
+      : frozen_set(items.begin(), items.end()) {}
+
+  // возвращает итератор на наименьший элемент
+  const_iterator begin() const noexcept { return layout_.Begin(); }
+
+  // возвращает итератор на конец контейнера(после последнего элемента)
+  const_iterator end() const noexcept { return layout_.End(); }
+
+  // Возвращает кол-во элементов контейнера
+  size_type size() const noexcept { return layout_.Size(); }
+
+  // Возвращает true если контейнер пустой, false если нет
+  bool empty() const noexcept { return layout_.Size() == 0; }
+
+  // Находит элемент с ключом эквивалентный ключу key
+  const_iterator find(const key_type &key) const noexcept {
+    return layout_.Find(key);
+  }
+
+  // Проверка на элемент с ключом key(true-да,false-нет)
+  bool contains(const key_type &key) const noexcept {
+    return layout_.Find(key) != layout_.End();
+  }
+
+  // Количество элементов с ключом key(0 или 1)
+  size_type count(const key_type &key) const noexcept {
+    return contains(key) ? 1 : 0;
+  }
+
+  // Итератор на первый элемент, не меньший key
+  const_iterator lower_bound(const key_type &key) const noexcept {
+    return layout_.LowerBound(key);
+  }
+
+  // Итератор на первый элемент, больший key
+  const_iterator upper_bound(const key_type &key) const noexcept {
+    return layout_.UpperBound(key);
+  }
+
+  // Версии для ключа K при прозрачном Compare
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator find(const K &key) const noexcept {
+    return layout_.Find(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  bool contains(const K &key) const noexcept {
+    return layout_.Find(key) != layout_.End();
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  size_type count(const K &key) const noexcept {
+    return contains(key) ? 1 : 0;
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator lower_bound(const K &key) const noexcept {
+    return layout_.LowerBound(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator upper_bound(const K &key) const noexcept {
+    return layout_.UpperBound(key);
+  }
+
+ private:
+  layout_type layout_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_FROZEN_SET_H_
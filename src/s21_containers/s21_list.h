@@ -5,102 +5,143 @@
 #include <cstddef>
 #include <initializer_list>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <utility>
 
 #include "iterators/s21_list_iterator.h"
+#include "s21_allocator.h"
 #include "s21_list_node.h"
 
 namespace s21 {
-template <typename T>
-class list {
+// Узлы списка берутся у Allocator, перевязанного на тип узла через
+// std::allocator_traits. Фиктивный узел end() хранится в самом объекте,
+// поэтому пустой список ничего не выделяет. Узлы, освобожденные erase и
+// pop_*, остаются в запасе списка и используются при следующих вставках:
+// очередь, в которую кладут и из которой забирают, перестает обращаться к
+// аллокатору. Запас освобождают clear(), shrink_to_fit() и деструктор
+template <typename T, typename Allocator = std::allocator<T>>
+class list : private AllocatorStorage<rebind_alloc_t<Allocator, Node<T>>> {
+  using node_allocator = rebind_alloc_t<Allocator, Node<T>>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  using value_allocator = rebind_alloc_t<Allocator, T>;
+  using value_traits = std::allocator_traits<value_allocator>;
+  using storage = AllocatorStorage<node_allocator>;
+
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
   using iterator = ListIterator<T>;
   using const_iterator = const iterator;
   using size_type = size_t;
 
-  list() { end_.node_ = new Node(value_type()); }
+  list() = default;
+
+  explicit list(const allocator_type &alloc)
+      : storage(node_allocator(alloc)) {}
 
-  list(size_type n) : list() {
+  list(size_type n, const allocator_type &alloc = allocator_type())
+      : list(alloc) {
     for (size_type i = 0; i < n; i += 1) {
-      push_back(value_type());
+      emplace_back();
     }
   }
 
-  list(std::initializer_list<value_type> const &items) : list() {
+  list(std::initializer_list<value_type> const &items,
+       const allocator_type &alloc = allocator_type())
+      : list(alloc) {
     for (const auto &i : items) {
       push_back(i);
     }
   }
 
-  list(const list &l) : list() { operator=(l); }
+  // Копия получает аллокатор от select_on_container_copy_construction
+  list(const list &l)
+      : list(l, allocator_type(
+                    node_traits::select_on_container_copy_construction(
+                        l.allocator()))) {}
 
-  list(list &&l) : list() {
-    if (this != &l) {
-      clear();
-      size_ = l.size_;
-      begin_ = l.begin_;
-      end_.node_->prev_ = l.end_.node_->prev_;
-      if (end_.node_->prev_ != nullptr) {
-        end_.node_->prev_->next_ = end_.node_;
-      }
-      l.size_ = 0;
-      l.end_.node_->prev_ = nullptr;
+  list(const list &l, const allocator_type &alloc) : list(alloc) {
+    for (const ListNodeBase *node = l.head_; node != &l.end_;
+         node = node->next_) {
+      push_back(valueOf(node));
     }
   }
 
-  ~list() {
-    clear();
-    delete end_.node_;
+  // Узлы l переходят вместе с аллокатором, ничего не выделяется
+  list(list &&l) noexcept : storage(l.allocator()) { swapNodes(l); }
+
+  // Узлы l забираются, только если alloc может их освободить, иначе
+  // значения перемещаются в новые узлы
+  list(list &&l, const allocator_type &alloc) : list(alloc) {
+    if (allocator() == l.allocator()) {
+      swapNodes(l);
+    } else {
+      moveValuesFrom(l);
+    }
   }
 
+  ~list() { clear(); }
+
   list &operator=(const list &l) {
     if (this != &l) {
-      clear();
-      Node<T> *buf = l.begin_.node_;
-      while (buf != l.end_.node_) {
-        push_back(buf->value_);
-        buf = buf->next_;
+      constexpr bool propagate =
+          node_traits::propagate_on_container_copy_assignment::value;
+      list tmp(l, propagate ? l.get_allocator() : get_allocator());
+      swapNodes(tmp);
+      if constexpr (propagate) {
+        using std::swap;
+        swap(allocator(), tmp.allocator());
       }
     }
     return *this;
   }
 
-  const_reference front() {
-    if (begin_.node_ == nullptr) {
-      throw "Collection is empty";
+  // Узлы l переходят к *this без копирования, если аллокаторы равны или
+  // аллокатор переходит вместе с ними(propagate_on_container_move_assignment)
+  list &operator=(list &&l) noexcept(kMoveStealsMemory<node_allocator>) {
+    if (this == &l) return *this;
+    if constexpr (kMoveStealsMemory<node_allocator>) {
+      stealNodes(l);
+    } else if (allocator() == l.allocator()) {
+      stealNodes(l);
+    } else {
+      clear();
+      moveValuesFrom(l);
     }
-    return (*begin_);
+    return *this;
   }
 
-  const_reference back() {
-    if (begin_.node_ == nullptr) {
-      throw "Collection is empty";
-    }
-    return (end_.node_->prev_->value_);
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(allocator());
   }
 
-  iterator begin() {
+  const_reference front() {
     if (empty()) {
-      return end_;
-    } else {
-      return begin_;
+      throw "Collection is empty";
     }
+    return valueOf(head_);
   }
 
-  iterator end() { return end_; }
-
-  const_iterator begin() const {
+  const_reference back() {
     if (empty()) {
-      return const_iterator(end_.node_);
-    } else {
-      return const_iterator(begin_.node_);
+      throw "Collection is empty";
     }
+    return valueOf(end_.prev_);
   }
 
-  const_iterator end() const { return const_iterator(end_.node_); }
+  iterator begin() { return iterator(head_); }
+
+  iterator end() { return iterator(&end_); }
+
+  const_iterator begin() const { return const_iterator(head_); }
+
+  const_iterator end() const {
+    return const_iterator(const_cast<ListNodeBase *>(&end_));
+  }
 
   bool empty() const noexcept { return size_ == 0; }
 
@@ -110,207 +151,472 @@ class list {
     return (std::numeric_limits<size_type>::max() / sizeof(Node<T>) / 2);
   }
 
-  void clear() {
-    while (!empty()) {
-      pop_back();
+  // Удаляет все элементы и возвращает аллокатору все узлы, в том числе
+  // запас
+  void clear() noexcept {
+    ListNodeBase *node = head_;
+    while (node != &end_) {
+      ListNodeBase *next = node->next_;
+      destroyValue(node);
+      deallocateNode(node);
+      node = next;
     }
-    end_.node_->prev_ = nullptr;
+    head_ = &end_;
+    end_.prev_ = nullptr;
+    size_ = 0;
+    shrink_to_fit();
   }
 
-  iterator insert(iterator pos, const_reference value) {
-    if (size_ + 1 > max_size()) throw "Maximum of container";
-    iterator res;
-    if (pos == end_) {
-      if (end_.node_->prev_ == nullptr) {
-        begin_.node_ = new Node<value_type>(value, nullptr, end_.node_);
-        end_.node_->prev_ = begin_.node_;
-        res = begin_;
-      } else {
-        auto buf = end_.node_->prev_;
-        end_.node_->prev_ =
-            new Node<value_type>(value, end_.node_->prev_, end_.node_);
-        buf->next_ = end_.node_->prev_;
-        res = iterator(end_.node_->prev_);
-      }
-    } else {
-      if (pos == begin_) {
-        begin_.node_ = new Node<value_type>(value, nullptr, pos.node_);
-        pos.node_->prev_ = begin_.node_;
-        res = begin_;
-      } else {
-        pos.node_->prev_->next_ =
-            new Node<value_type>(value, pos.node_->prev_, pos.node_);
-        pos.node_->prev_ = pos.node_->prev_->next_;
-        res = iterator(pos.node_->prev_);
-      }
+  // Возвращает аллокатору узлы, оставшиеся в запасе после удалений
+  void shrink_to_fit() noexcept {
+    while (free_ != nullptr) {
+      ListNodeBase *node = free_;
+      free_ = free_->next_;
+      deallocateNode(node);
     }
-    size_ += 1;
-    return res;
+  }
+
+  iterator insert(iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
   }
 
   void erase(iterator pos) {
-    if (size_ != 0 && pos.node_ != nullptr && pos != end_) {
-      if (pos == begin_) {
-        begin_.node_ = begin_.node_->next_;
-        delete begin_.node_->prev_;
-        begin_.node_->prev_ = nullptr;
-      } else {
-        pos.node_->prev_->next_ = pos.node_->next_;
-        pos.node_->next_->prev_ = pos.node_->prev_;
-        delete pos.node_;
-      }
+    S21_ITERATOR_CHECK(pos.node_ == nullptr || ownsNode(pos.node_),
+                       "iterator of another list");
+    if (size_ != 0 && pos.node_ != nullptr && pos.node_ != &end_) {
+      unlinkNodes(pos.node_, pos.node_);
+      destroyNode(pos.node_);
       size_ -= 1;
     }
   }
 
-  void push_back(const_reference value) { insert(end_, value); }
+  void push_back(const_reference value) { emplace(end(), value); }
+
+  void push_back(value_type &&value) { emplace(end(), std::move(value)); }
 
   void pop_back() {
     if (!empty()) {
-      erase(iterator(end_.node_->prev_));
+      erase(iterator(end_.prev_));
     }
   }
 
-  void push_front(const_reference value) {
-    if (empty()) {
-      push_back(value);
-    } else {
-      insert(begin(), value);
-    }
-  }
+  void push_front(const_reference value) { emplace(begin(), value); }
+
+  void push_front(value_type &&value) { emplace(begin(), std::move(value)); }
 
   void pop_front() {
     if (!empty()) {
-      erase(begin_);
+      erase(begin());
     }
   }
 
-  void swap(list &other) {
-    auto temp = std::move(other);
-    other = std::move(*this);
-    *this = std::move(temp);
+  // Обмен узлами за O(1). Аллокаторы обмениваются, только если этого
+  // требует propagate_on_container_swap(иначе они должны быть равны)
+  void swap(list &other) noexcept {
+    swapNodes(other);
+    PropagateOnSwap(allocator(), other.allocator());
   }
 
-  void merge(list &other) {
+  // Слияние двух отсортированных списков без выделений памяти: узлы other
+  // вплетаются в *this. Равные элементы *this идут раньше элементов other.
+  // Аллокаторы списков должны быть равны
+  void merge(list &other) { merge(other, std::less<>()); }
+
+  void merge(list &&other) { merge(other); }
+
+  template <typename Compare>
+  void merge(list &other, Compare comp) {
+    if (this == &other || other.empty()) return;
     if (size_ + other.size_ > max_size()) throw "Maximum of container";
-    auto merged = list(size_ + other.size_);
-    auto firstIter = begin();
-    auto secondIter = other.begin();
-    for (auto iter = merged.begin(); iter != merged.end(); ++iter) {
-      if (firstIter == end()) {
-        *iter = *secondIter;
-        ++secondIter;
-      } else {
-        if (secondIter == other.end()) {
-          *iter = *firstIter;
-          ++firstIter;
-        } else {
-          if (*firstIter < *secondIter) {
-            *iter = *firstIter;
-            ++firstIter;
-          } else {
-            *iter = *secondIter;
-            ++secondIter;
-          }
-        }
-      }
+    if (empty()) {
+      splice(end(), other);
+      return;
     }
-    clear();
-    other.clear();
-    *this = std::move(merged);
+    ListNodeBase *merged = mergeRuns(detachChain(), other.detachChain(), comp);
+    size_ += other.size_;
+    other.size_ = 0;
+    relinkChain(merged);
   }
 
+  template <typename Compare>
+  void merge(list &&other, Compare comp) {
+    merge(other, comp);
+  }
+
+  // splice перецепляет узлы other перед pos за O(1), без копирования
+  // значений. Итераторы на перенесенные элементы остаются действительными и
+  // указывают теперь в *this. Аллокаторы списков должны быть равны
   void splice(const_iterator pos, list &other) {
+    if (this == &other || other.empty()) return;
     if (size_ + other.size_ > max_size()) throw "Maximum of container";
-    for (auto i = --(other.end()); i != other.begin(); --i) {
-      insert(iterator(pos), *i);
+    S21_ITERATOR_CHECK(ownsNode(pos.node_), "iterator of another list");
+    ListNodeBase *first = other.head_;
+    ListNodeBase *last = other.end_.prev_;
+    other.unlinkNodes(first, last);
+    linkNodes(pos.node_, first, last);
+    size_ += other.size_;
+    other.size_ = 0;
+  }
+
+  void splice(const_iterator pos, list &&other) { splice(pos, other); }
+
+  // Переносит один элемент it из other(other может быть *this)
+  void splice(const_iterator pos, list &other, const_iterator it) {
+    S21_ITERATOR_CHECK(ownsNode(pos.node_), "iterator of another list");
+    S21_ITERATOR_CHECK(other.ownsNode(it.node_) && it.node_ != &other.end_,
+                       "iterator is out of range");
+    if (it.node_ == pos.node_ || it.node_->next_ == pos.node_) return;
+    other.unlinkNodes(it.node_, it.node_);
+    linkNodes(pos.node_, it.node_, it.node_);
+    other.size_ -= 1;
+    size_ += 1;
+  }
+
+  void splice(const_iterator pos, list &&other, const_iterator it) {
+    splice(pos, other, it);
+  }
+
+  // Переносит [first, last) из other. Внутри одного списка это O(1), между
+  // разными списками O(k): размер считается проходом по k узлам диапазона.
+  // pos не должен лежать внутри [first, last)
+  void splice(const_iterator pos, list &other, const_iterator first,
+              const_iterator last) {
+    S21_ITERATOR_CHECK(ownsNode(pos.node_), "iterator of another list");
+    if (first.node_ == last.node_) return;
+    ListNodeBase *back = last.node_->prev_;
+    if (this != &other) {
+      size_type count = 1;
+      for (ListNodeBase *node = first.node_; node != back; node = node->next_)
+        count += 1;
+      if (size_ + count > max_size()) throw "Maximum of container";
+      other.size_ -= count;
+      size_ += count;
     }
-    insert(iterator(pos), *other.begin());
-    other.clear();
+    other.unlinkNodes(first.node_, back);
+    linkNodes(pos.node_, first.node_, back);
+  }
+
+  void splice(const_iterator pos, list &&other, const_iterator first,
+              const_iterator last) {
+    splice(pos, other, first, last);
   }
 
   void reverse() {
     auto leftIter = begin();
-    auto rigthIter = iterator(end_.node_->prev_);
+    auto rigthIter = iterator(end_.prev_);
     for (size_type i = 0; i < size_ / 2; i += 1) {
-      auto buf = *leftIter;
-      *leftIter = *rigthIter;
-      *rigthIter = buf;
+      using std::swap;
+      swap(*leftIter, *rigthIter);
       ++leftIter;
       --rigthIter;
     }
   }
 
   void unique() {
-    auto i = begin();
-    auto check = *i;
+    if (empty()) return;
+    iterator check = begin();
+    iterator i = begin();
     ++i;
     while (i != end()) {
-      if (*i == check) {
+      // следующий берем до удаления: итератор удаленного узла недействителен
+      iterator next = i;
+      ++next;
+      if (*i == *check) {
         erase(i);
       } else {
-        check = *i;
+        check = i;
       }
-      ++i;
+      i = next;
     }
   }
 
+  // Элемент создается прямо в новом узле перед pos из аргументов
+  // конструктора args, без временного объекта и копирования
   template <typename... Args>
-  iterator emplace(const_iterator ind, Args &&...args) {
-    iterator iter = ind;
-    for (auto &&item : {std::forward<Args>(args)...}) {
-      push_back(++iter, item);
-    }
-    return iter;
+  iterator emplace(const_iterator pos, Args &&...args) {
+    if (size_ + 1 > max_size()) throw "Maximum of container";
+    S21_ITERATOR_CHECK(ownsNode(pos.node_), "iterator of another list");
+    ListNodeBase *node = createNode(std::forward<Args>(args)...);
+    linkNodes(pos.node_, node, node);
+    size_ += 1;
+    return iterator(node);
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+  }
+
+  // Вставляет каждый из args отдельным элементом перед pos, возвращает
+  // итератор на последний вставленный(или pos, если args пуст)
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    iterator res = pos;
+    ((res = emplace(pos, std::forward<Args>(args))), ...);
+    return res;
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (emplace(end(), std::forward<Args>(args)), ...);
   }
 
+  // Элементы args оказываются в начале списка в том же порядке
   template <typename... Args>
-  void emplace_back(Args &&...args) {
-    for (auto &&item : {std::forward<Args>(args)...}) {
-      push_back(item);
+  void insert_many_front(Args &&...args) {
+    insert_many(begin(), std::forward<Args>(args)...);
+  }
+
+  // Устойчивая сортировка слиянием снизу вверх за O(n log n): узлы только
+  // перецепляются, поэтому нет ни выделений памяти, ни копирования значений,
+  // а итераторы остаются действительными
+  void sort() { sort(std::less<>()); }
+
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ < 2) return;
+    // bins[i] - уже отсортированная цепочка из 2^i узлов(или пустая), узлы
+    // в bins[i] стоят в исходном списке раньше, чем узлы в bins[i - 1]
+    ListNodeBase *bins[std::numeric_limits<size_type>::digits] = {};
+    size_type used = 0;
+    ListNodeBase *node = detachChain();
+    while (node != nullptr) {
+      ListNodeBase *carry = node;
+      node = node->next_;
+      carry->next_ = nullptr;
+      carry->prev_ = carry;
+      size_type i = 0;
+      for (; bins[i] != nullptr; i += 1) {
+        carry = mergeRuns(bins[i], carry, comp);
+        bins[i] = nullptr;
+      }
+      bins[i] = carry;
+      if (i == used) used += 1;
     }
+    ListNodeBase *sorted = nullptr;
+    for (size_type i = 0; i < used; i += 1) {
+      if (bins[i] != nullptr) {
+        sorted = sorted == nullptr ? bins[i] : mergeRuns(bins[i], sorted, comp);
+      }
+    }
+    relinkChain(sorted);
   }
 
+ private:
+  using storage::allocator;
+
+  static reference valueOf(ListNodeBase *node) noexcept {
+    return static_cast<Node<T> *>(node)->value_;
+  }
+
+  static const_reference valueOf(const ListNodeBase *node) noexcept {
+    return static_cast<const Node<T> *>(node)->value_;
+  }
+
+  // Создает значение из args в узле из запаса или в новом узле. Значение
+  // создается через std::allocator_traits, поэтому элементы, которым нужен
+  // аллокатор(например std::pmr::string), получают аллокатор списка
   template <typename... Args>
-  void emplace_front(Args &&...args) {
-    for (auto &&item : {std::forward<Args>(args)...}) {
-      push_front(item);
+  ListNodeBase *createNode(Args &&...args) {
+    Node<T> *node;
+    if (free_ != nullptr) {
+      node = static_cast<Node<T> *>(free_);
+      free_ = free_->next_;
+    } else {
+      node = node_traits::allocate(allocator(), 1);
+      new (node) Node<T>();
     }
+    try {
+      value_allocator alloc(allocator());
+      value_traits::construct(alloc, std::addressof(node->value_),
+                              std::forward<Args>(args)...);
+    } catch (...) {
+      node->next_ = free_;
+      free_ = node;
+      throw;
+    }
+    return node;
+  }
+
+  void destroyValue(ListNodeBase *node) noexcept {
+    value_allocator alloc(allocator());
+    value_traits::destroy(alloc, std::addressof(valueOf(node)));
   }
 
-  void sort() {
-    iterator middle = this->GetMiddleList();
-    list<T> temp;
-    for (auto it = temp.begin(); middle != this->end();) {
-      iterator temp_it = middle;
-      temp.insert(it, *middle);
-      ++middle;
-      this->erase(temp_it);
-      ++it;
+  // Разрушает значение, сам узел уходит в запас
+  void destroyNode(ListNodeBase *node) noexcept {
+    destroyValue(node);
+    node->next_ = free_;
+    free_ = node;
+  }
+
+  // Возвращает аллокатору узел без значения
+  void deallocateNode(ListNodeBase *node) noexcept {
+    Node<T> *full = static_cast<Node<T> *>(node);
+    full->~Node();
+    node_traits::deallocate(allocator(), full, 1);
+  }
+
+  // Обмен содержимым без аллокаторов. Узлы, ссылавшиеся на фиктивный узел
+  // другого списка, перецепляются на свой
+  void swapNodes(list &other) noexcept {
+    std::swap(head_, other.head_);
+    std::swap(end_.prev_, other.end_.prev_);
+    std::swap(size_, other.size_);
+    std::swap(free_, other.free_);
+    attachEnd();
+    other.attachEnd();
+  }
+
+  void attachEnd() noexcept {
+    if (empty()) {
+      head_ = &end_;
+    } else {
+      end_.prev_->next_ = &end_;
     }
-    if (this->size() != 1) {
-      this->sort();
+  }
+
+  // Перемещающее присваивание, когда узлы l можно забрать целиком.
+  // Старые узлы *this уходят в l вместе со своим аллокатором и удаляются
+  void stealNodes(list &l) noexcept {
+    swapNodes(l);
+    if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+      using std::swap;
+      swap(allocator(), l.allocator());
     }
-    if (temp.size() != 1) {
-      temp.sort();
+    l.clear();
+  }
+
+  // Значения l перемещаются в новые узлы в конце *this, память l
+  // освобождается
+  void moveValuesFrom(list &l) {
+    for (ListNodeBase *node = l.head_; node != &l.end_; node = node->next_) {
+      emplace_back(std::move(valueOf(node)));
     }
-    this->merge(temp);
+    l.clear();
   }
 
- private:
-  iterator GetMiddleList() {
-    auto it_fast = this->begin();
-    auto it_slow = this->begin();
-    auto it_fake = this->end();
-    for (; it_fast != it_fake && ++it_fast != it_fake;) {
-      ++it_slow;
-      ++it_fast;
+  // Узел принадлежит списку, если от него по next_ доходим до нашего end_.
+  // Используется только в режиме S21_CHECKED_ITERATORS, O(n)
+  bool ownsNode(const ListNodeBase *node) const noexcept {
+    while (node->next_ != nullptr) node = node->next_;
+    return node == &end_;
+  }
+
+  // Вырезает узлы [first, last](last - не фиктивный узел) из списка, не
+  // меняя size_ и не освобождая их
+  void unlinkNodes(ListNodeBase *first, ListNodeBase *last) noexcept {
+    ListNodeBase *prev = first->prev_;
+    ListNodeBase *next = last->next_;
+    if (prev == nullptr) {
+      head_ = next;
+    } else {
+      prev->next_ = next;
     }
-    return it_slow;
+    next->prev_ = prev;
   }
 
-  iterator begin_, end_;
+  // Вставляет уже связанную по next_ цепочку [first, last] перед pos
+  void linkNodes(ListNodeBase *pos, ListNodeBase *first,
+                 ListNodeBase *last) noexcept {
+    ListNodeBase *prev = pos->prev_;
+    first->prev_ = prev;
+    if (prev == nullptr) {
+      head_ = first;
+    } else {
+      prev->next_ = first;
+    }
+    last->next_ = pos;
+    pos->prev_ = last;
+  }
+
+  // Отцепляет все узлы непустого списка цепочкой в формате mergeRuns.
+  // size_ не меняется
+  ListNodeBase *detachChain() noexcept {
+    ListNodeBase *head = head_;
+    ListNodeBase *tail = end_.prev_;
+    tail->next_ = nullptr;
+    head->prev_ = tail;
+    end_.prev_ = nullptr;
+    head_ = &end_;
+    return head;
+  }
+
+  // Сливает две отсортированные цепочки. Внутри цепочки узлы связаны в обе
+  // стороны, а prev_ первого узла указывает на последний: так конец цепочки
+  // известен без прохода по ней. Узлы second вплетаются в first серией
+  // перед первым большим узлом first, узлы first остаются на местах.
+  // Узел second идет раньше только если он строго меньше, поэтому слияние
+  // устойчиво
+  template <typename Compare>
+  static ListNodeBase *mergeRuns(ListNodeBase *first, ListNodeBase *second,
+                                 Compare &comp) {
+    ListNodeBase *tail = first->prev_;
+    ListNodeBase *second_tail = second->prev_;
+    ListNodeBase *head = first;
+    ListNodeBase *prev = nullptr;
+    while (first != nullptr && second != nullptr) {
+      if (comp(valueOf(second), valueOf(first))) {
+        ListNodeBase *run = second;
+        ListNodeBase *run_last = second;
+        second = second->next_;
+        while (second != nullptr && comp(valueOf(second), valueOf(first))) {
+          run_last = second;
+          second = second->next_;
+        }
+        run->prev_ = prev;
+        if (prev == nullptr) {
+          head = run;
+        } else {
+          prev->next_ = run;
+        }
+        run_last->next_ = first;
+        first->prev_ = run_last;
+      }
+      prev = first;
+      first = first->next_;
+    }
+    if (second != nullptr) {
+      prev->next_ = second;
+      second->prev_ = prev;
+      tail = second_tail;
+    }
+    head->prev_ = tail;
+    return head;
+  }
+
+  // Делает цепочку head(в формате mergeRuns, из size_ узлов) содержимым
+  // списка: замыкает ее на фиктивный узел
+  void relinkChain(ListNodeBase *head) noexcept {
+    ListNodeBase *tail = head->prev_;
+    head->prev_ = nullptr;
+    head_ = head;
+    tail->next_ = &end_;
+    end_.prev_ = tail;
+  }
+
+  // Первый узел, у пустого списка - фиктивный end_
+  ListNodeBase *head_ = &end_;
+  // Фиктивный узел: prev_ - последний элемент, next_ всегда nullptr
+  ListNodeBase end_;
+  // Запас узлов без значений, связанных по next_
+  ListNodeBase *free_ = nullptr;
   size_type size_ = 0;
 };
+
+namespace pmr {
+// list, узлы которого берутся из std::pmr::memory_resource
+template <typename T>
+using list = s21::list<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 }  // namespace s21
 #endif  // S21_CONTAINERS_S21_LIST_H
@@ -2,19 +2,30 @@
 #define S21_CONTAINERS_S21_LIST_NODE_H
 
 namespace s21 {
-template <typename T>
+template <typename T, typename Allocator>
 class list;
 
 template <typename T>
 class ListIterator;
 
+// Связи узла списка. Фиктивный узел end() хранится прямо в объекте списка
+// и состоит только из связей: значения у него нет
+struct ListNodeBase {
+  ListNodeBase* next_ = nullptr;
+  ListNodeBase* prev_ = nullptr;
+};
+
+// Узел со значением. Значение создается и разрушается списком через
+// std::allocator_traits отдельно от самого узла, поэтому узел без значения
+// можно держать в запасе и использовать повторно
 template <typename T>
-struct Node {
-  T value_ = T();
-  Node* next_ = nullptr;
-  Node* prev_ = nullptr;
-  explicit Node(T value = T(), Node* prev = nullptr, Node* next = nullptr)
-      : value_(value), next_(next), prev_(prev) {}
+struct Node : ListNodeBase {
+  Node() noexcept {}
+  ~Node() {}
+
+  union {
+    T value_;
+  };
 };
 }  // namespace s21
 #endif  // S21_CONTAINERS_S21_LIST_NODE_H
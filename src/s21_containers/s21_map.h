@@ -1,12 +1,19 @@
 #ifndef S21_CONTAINERS_S21_MAP_H_
 #define S21_CONTAINERS_S21_MAP_H_
 
+#include <memory_resource>
 #include <stdexcept>
+#include <tuple>
 
 #include "s21_tree.h"
 
 namespace s21 {
-template <class Key, class Type>
+// Compare - порядок ключей, Statistic - политика дерева(OrderStatistic
+// добавляет find_by_order и order_of_key), Allocator - откуда берется
+// память дерева(см. RBTree)
+template <class Key, class Type, class Compare = std::less<Key>,
+          class Statistic = NoOrderStatistic,
+          class Allocator = std::allocator<std::pair<Key, Type>>>
 class map {
  public:
   // Тим элемента-ключ
@@ -24,54 +31,105 @@ class map {
   // равны
   struct MapCmprt {
     bool operator()(const_reference op1, const_reference op2) const noexcept {
-      return op1.first < op2.first;
+      return key_cmp_(op1.first, op2.first);
     }
+
+    // Сравнение пары с голым ключом(поиск без создания временной пары)
+    bool operator()(const key_type &key, const_reference op) const noexcept {
+      return key_cmp_(key, op.first);
+    }
+
+    bool operator()(const_reference op, const key_type &key) const noexcept {
+      return key_cmp_(op.first, key);
+    }
+
+    // Сравнение с ключом любого типа K, если Compare прозрачный
+    template <typename K, typename C = Compare, typename = transparent_t<C>>
+    bool operator()(const K &key, const_reference op) const noexcept {
+      return key_cmp_(key, op.first);
+    }
+
+    template <typename K, typename C = Compare, typename = transparent_t<C>>
+    bool operator()(const_reference op, const K &key) const noexcept {
+      return key_cmp_(op.first, key);
+    }
+
+    Compare key_cmp_;
   };
   // Внутренние классы
   //  1)дерева
-  using tree_type = RBTree<value_type, MapCmprt>;
+  using tree_type =
+      RBTree<value_type, MapCmprt, NodePool, Statistic, Allocator>;
   // 2)итератор
   using iterator = typename tree_type::iterator;
   // 3)константный итератор
   using const_iterator = typename tree_type::const_iterator;
+  // 4)извлеченный узел(node handle)
+  using node_type = typename tree_type::node_type;
+  // 5)результат вставки node handle
+  using insert_return_type = typename tree_type::insert_return_type;
 
   // Тип для размера контейнера
   using size_type = std::size_t;
+  // Аллокатор словаря
+  using allocator_type = Allocator;
 
   // конструктор создания(по-умолчанию)
-  map() : tree_(new tree_type{}) {}
+  map() = default;
+
+  // пустой словарь, память которого берется у alloc
+  explicit map(const allocator_type &alloc) : tree_(alloc) {}
 
   // конструктор для создания инициализаторов(создает словарь(инициализирует с
   // помощью std::initializer_list))
-  map(std::initializer_list<value_type> const &items) : map() {
-    for (auto item : items) insert(item);
+  map(std::initializer_list<value_type> const &items,
+      const allocator_type &alloc = allocator_type())
+      : map(items.begin(), items.end(), alloc) {}
+
+  // конструктор из диапазона пар [first, last). Если ключи уже идут по
+  // возрастанию, то словарь строится за линейное время
+  template <typename InputIt>
+  map(InputIt first, InputIt last,
+      const allocator_type &alloc = allocator_type())
+      : map(alloc) {
+    tree_.AssignRange(first, last, true);
   }
 
   // конструктор копирования
-  map(const map &m) : tree_(new tree_type(*m.tree_)) {}
+  map(const map &m) : tree_(m.tree_) {}
+
+  // копия m в памяти alloc
+  map(const map &m, const allocator_type &alloc) : tree_(m.tree_, alloc) {}
 
   // конструктор переноса
-  map(map &&m) noexcept : tree_(new tree_type(std::move(*m.tree_))) {}
+  map(map &&m) noexcept : tree_(std::move(m.tree_)) {}
+
+  // перенос m в память alloc(пары перемещаются, если аллокаторы не равны)
+  map(map &&m, const allocator_type &alloc)
+      : tree_(std::move(m.tree_), alloc) {}
 
   // оператор присваивания(копирование)
-  map *operator=(const map &m) {
-    *tree_ = *m.tree_;
+  map &operator=(const map &m) {
+    tree_ = m.tree_;
+    return *this;
+  }
+
+  // оператор присваивания переносом
+  map &operator=(map &&m) noexcept(kMoveStealsMemory<Allocator>) {
+    tree_ = std::move(m.tree_);
     return *this;
   }
 
-  // Деструктор
-  ~map() {
-    delete tree_;
-    // так же зануляем tree_
-    tree_ = nullptr;
+  // Аллокатор словаря
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
   }
 
   // Доступ к указанному элементу(плюс проверка границ). Возвращает ссылку на
   // значение с ключом Если такого элемента нет-вызывается исключение
   //  std::out_of_range
   mapped_type &at(const key_type &key) {
-    value_type search_pair(key, mapped_type{});
-    iterator search_iter = tree_->Find(search_pair);
+    iterator search_iter = tree_.Find(key);
 
     if (search_iter == end())
       throw std::out_of_range("No elements with key");
@@ -80,99 +138,277 @@ class map {
   }
 
   // const версия at()
-  const mapped_type &at(const key_type *key) const {
-    return const_cast<map<Key, Type> *>(this)->at(key);
+  const mapped_type &at(const key_type &key) const {
+    return const_cast<map *>(this)->at(key);
   }
 
   // Возвращает ссылку на значение с ключом key. Если такого элемента нет,
-  // то выполняется вставка
+  // то выполняется вставка(значение создается по умолчанию)
   mapped_type &operator[](const key_type &key) {
-    value_type search_pair(key, mapped_type{});
-    iterator search_iter = tree_->Find(search_pair);
+    return (*try_emplace(key).first).second;
+  }
 
-    if (search_iter == end()) {
-      std::pair<iterator, bool> res = tree_->UniqueInsert(search_pair);
-      return (*res.first).second;
-    } else
-      return (*search_iter).second;
+  // rvalue версия operator[](ключ перемещается в новый элемент)
+  mapped_type &operator[](key_type &&key) {
+    return (*try_emplace(std::move(key)).first).second;
+  }
+
+  // Вставляет пару(key, mapped_type(args...)), если ключа key еще нет.
+  // Поиск и вставка выполняются за один спуск по дереву, значение создается
+  // только при вставке. Если ключ уже есть, args не трогаются
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return tree_.FindOrEmplace(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  // try_emplace() с перемещением ключа(ключ перемещается только при вставке)
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+    return tree_.FindOrEmplace(
+        key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
   }
 
   // возвращает итератор в начало контейнера
-  iterator begin() noexcept { return tree_->begin_(); }
+  iterator begin() noexcept { return tree_.begin_(); }
 
   // тот же begin только для const
-  const_iterator begin() const noexcept { return tree_->begin_(); }
+  const_iterator begin() const noexcept { return tree_.begin_(); }
 
   // возвращает итератор на конец контейнера(после последнего элемента)
-  iterator end() noexcept { return tree_->end_(); }
+  iterator end() noexcept { return tree_.end_(); }
 
   // const версия для end()
-  const_iterator end() const noexcept { return tree_->end_(); }
+  const_iterator end() const noexcept { return tree_.end_(); }
 
   // Возвращает кол-во элементов контейнера
-  size_type size() const noexcept { return tree_->_size_(); }
+  size_type size() const noexcept { return tree_._size_(); }
 
   // Возвращает true если контейнер пустой, false если нет
-  bool empty() const noexcept { return tree_->isEmpty(); }
+  bool empty() const noexcept { return tree_.isEmpty(); }
 
   // Возвращает максимально допустимое кол-во элементов в контейнере
-  size_type max_size() const noexcept { return tree_->maxSize(); }
+  size_type max_size() const noexcept { return tree_.maxSize(); }
 
   // очистка содержимого контейнера
-  void clear() noexcept { tree_->clear(); }
+  void clear() noexcept { tree_.clear(); }
 
   // удаляет элемент по передаваемой позиции ind
-  void erase(iterator pos) noexcept { tree_->Erase(pos); }
+  void erase(iterator pos) noexcept(!kCheckedIterators) {
+    tree_.Erase(pos);
+  }
 
   // Обменивает содержимое контейнера с other
-  void swap(map &other) noexcept { tree_->swap(*other.tree_); }
+  void swap(map &other) noexcept { tree_.swap(other.tree_); }
 
   // Вытаскиваем из other вставляем в контейнер. Если такой элемент есть-вставка
-  // не происходит
-  void merge(map &other) noexcept { tree_->UniqueMerge(*other->tree_); }
+  // не происходит. Пулы контейнеров не разделяются. Если в other не
+  // остается элементов из его пула, то его блоки переходят к нам и узлы
+  // перевешиваются без копирования: ссылки и указатели на перенесенные
+  // элементы остаются действительными. Иначе(и при разных аллокаторах)
+  // элементы переносятся в новые узлы, и возможно исключение. Оставшиеся в
+  // other элементы не трогаются
+  void merge(map &other) {
+    tree_.UniqueMerge(other.tree_);
+  }
+
+  // Извлекает узел на позиции pos из контейнера. Node handle владеет узлом
+  // сам, поэтому элемент из пула один раз переносится в отдельный узел
+  node_type extract(const_iterator pos) {
+    return tree_.Extract(pos);
+  }
+
+  // Извлекает узел с ключом key(пустой node_type, если ключа нет)
+  node_type extract(const key_type &key) {
+    return tree_.ExtractKey(key);
+  }
+
+  // Вставляет извлеченный узел без выделения памяти. Если ключ уже есть, то
+  // узел возвращается обратно в поле node результата
+  insert_return_type insert(node_type &&nh) {
+    std::pair<iterator, bool> res = tree_.InsertNode(nh, true);
+    return insert_return_type{res.first, res.second, std::move(nh)};
+  }
+
+  // Операции над множествами. other поглощается целиком(после операции он
+  // пуст): его узлы переиспользуются или удаляются. При равных
+  // аллокаторах новых выделений нет. При разных элементы other сначала
+  // переносятся в новые узлы, и если это бросит исключение, оба
+  // контейнера не изменятся.
+  // При совпадении ключей остается значение из этого словаря
+
+  // this = this ∪ other
+  void set_union(map &other) { tree_.SetUnion(other.tree_, true); }
+
+  // this = this ∩ other
+  void set_intersection(map &other) {
+    tree_.SetIntersection(other.tree_, true);
+  }
+
+  // this = this \ other
+  void set_difference(map &other) {
+    tree_.SetDifference(other.tree_, true);
+  }
+
+  // Находит пару с ключом key
+  iterator find(const key_type &key) noexcept { return tree_.Find(key); }
+
+  // const версия для find()
+  const_iterator find(const key_type &key) const noexcept {
+    return tree_.Find(key);
+  }
 
   // Проверка на элемент с ключом key(true-да,false-нет)
   bool contains(const key_type &key) const noexcept {
-    value_type search_pair(key, mapped_type{});
-    iterator search_it = tree_->Find(search_pair);
-    return search_it != end();
+    return tree_.Find(key) != tree_.end_();
+  }
+
+  // Количество пар с ключом key(0 или 1)
+  size_type count(const key_type &key) const noexcept {
+    return contains(key) ? 1 : 0;
+  }
+
+  // Итератор на первую пару с ключом, не меньшим key
+  iterator lower_bound(const key_type &key) noexcept {
+    return tree_.LowBow(key);
+  }
+
+  // const версия lower_bound()
+  const_iterator lower_bound(const key_type &key) const noexcept {
+    return tree_.LowBow(key);
+  }
+
+  // Итератор на первую пару с ключом, большим key
+  iterator upper_bound(const key_type &key) noexcept {
+    return tree_.UppBow(key);
+  }
+
+  // const версия upper_bound()
+  const_iterator upper_bound(const key_type &key) const noexcept {
+    return tree_.UppBow(key);
+  }
+
+  // Поиск по ключу любого типа K, сравнимого с key_type(например
+  // std::string_view для строковых ключей). Только для прозрачного Compare
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  iterator find(const K &key) noexcept {
+    return tree_.Find(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator find(const K &key) const noexcept {
+    return tree_.Find(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  bool contains(const K &key) const noexcept {
+    return tree_.Find(key) != tree_.end_();
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  size_type count(const K &key) const noexcept {
+    return tree_.CountKey(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  iterator lower_bound(const K &key) noexcept {
+    return tree_.LowBow(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator lower_bound(const K &key) const noexcept {
+    return tree_.LowBow(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  iterator upper_bound(const K &key) noexcept {
+    return tree_.UppBow(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator upper_bound(const K &key) const noexcept {
+    return tree_.UppBow(key);
   }
 
   // Вставка в контейнер элемента со значением value, если он (контейнер прим.)
   // еще не содержит такого элемента с таким же ключом
   std::pair<iterator, bool> insert(const value_type &value) {
-    return tree_->UniqueInsert(value);
+    return tree_.UniqueInsert(value);
   }
 
   // Вставка в контейнер элемента со значениями key и obj, если он (контейнер
   // прим.) еще не содержит такого элемента с таким же ключом
   std::pair<iterator, bool> insert(const key_type &key,
                                    const mapped_type &obj) {
-    return tree_->UniqueInsert(value_type{key, obj});
+    return tree_.UniqueInsert(value_type{key, obj});
   }
 
-  // Ищет по key элемент и вставляет его, если не нашел, вставляет новое
-  // значение
-  std::pair<iterator, bool> insert_or_assign(const key_type &key,
-                                             const mapped_type &obj) {
-    iterator res = tree_->Find(value_type{key, obj});
+  // Вставка с подсказкой: hint - позиция, перед которой должен оказаться
+  // элемент. При верной подсказке(например end() для возрастающих ключей)
+  // спуска от корня не будет
+  iterator insert(const_iterator hint, const value_type &value) {
+    return tree_.InsertKey(hint, value, true).first;
+  }
 
-    if (res == end()) return tree_->UniqueInsert(value_type{key, obj});
-    (*res).second = obj;
+  // Создает пару из args и вставляет ее с подсказкой hint
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return tree_.EmplaceHint(hint, true, std::forward<Args>(args)...).first;
+  }
 
-    return {res, false};
+  // Ищет по key элемент и присваивает ему obj, если не нашел, вставляет
+  // новое значение(за один спуск по дереву)
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const key_type &key, M &&obj) {
+    std::pair<iterator, bool> res = try_emplace(key, std::forward<M>(obj));
+    if (!res.second) (*res.first).second = std::forward<M>(obj);
+    return res;
   }
 
-  // Размещаем новые элементы в контейнер, если такого ключа еще нет
+  // Возвращает итератор на k-ю по порядку ключей пару(нумерация с нуля) или
+  // end(), если k >= size(). Только для политики OrderStatistic, O(log n)
+  iterator find_by_order(size_type k) noexcept {
+    return tree_.FindByOrder(k);
+  }
+
+  // const версия find_by_order()
+  const_iterator find_by_order(size_type k) const noexcept {
+    return static_cast<const tree_type &>(tree_).FindByOrder(k);
+  }
+
+  // Возвращает количество ключей меньших key. Только для политики
+  // OrderStatistic, O(log n)
+  size_type order_of_key(const key_type &key) const noexcept {
+    return tree_.OrderOfKey(key);
+  }
+
+  // Создает пару из аргументов args прямо в узле дерева и вставляет ее,
+  // если такого ключа еще нет
   template <typename... Args>
-  std::vector<std::pair<iterator, bool>> emplace(Args &&...args) {
-    return tree_->UniqEmplace(std::forward<Args>(args)...);
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return tree_.Emplace(true, std::forward<Args>(args)...);
+  }
+
+  // Вставляет каждую из пар args, если такого ключа еще нет
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    return tree_.InsertMany(true, std::forward<Args>(args)...);
   }
 
  private:
-  tree_type *tree_;
+  tree_type tree_;
 };
 
+namespace pmr {
+// map, вся память которого берется из std::pmr::memory_resource
+template <class Key, class Type, class Compare = std::less<Key>,
+          class Statistic = NoOrderStatistic>
+using map = s21::map<Key, Type, Compare, Statistic,
+                     std::pmr::polymorphic_allocator<std::pair<Key, Type>>>;
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  // S21_CONTAINERS_S21_MAP_H_
@@ -0,0 +1,300 @@
+#ifndef S21_CONTAINERS_S21_MPMC_QUEUE_H_
+#define S21_CONTAINERS_S21_MPMC_QUEUE_H_
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "s21_cache_line.h"
+
+namespace s21 {
+// Ограниченная очередь для любого числа писателей и читателей. Кольцо из
+// степени двойки ячеек, у каждой ячейки свой номер(sequence_): он говорит,
+// чей сейчас ход в ячейке. Писатель с позицией pos ждет номер pos, читатель
+// - номер pos + 1. Позицию поток занимает одним CAS по tail_ или head_,
+// после чего работает с ячейкой один и отдает ее, записав следующий номер.
+//
+// try_push и try_pop не ждут: false, если очередь заполнена или пуста.
+// push и pop сначала несколько раз уступают процессор, затем засыпают на
+// условной переменной(futex-ожидания в C++17 нет). Быстрый путь
+// мьютекс не трогает: после каждой удачной операции проверяется лишь
+// счетчик спящих потоков, и только при ненулевом берется мьютекс.
+// close() будит всех: push после него возвращает false, pop отдает
+// оставшиеся элементы и возвращает false на пустой очереди
+template <typename T>
+class mpmc_queue {
+  // Занятую ячейку нельзя вернуть, поэтому элемент не должен бросать
+  // исключений при переносе
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T>,
+                "mpmc_queue::T must be nothrow movable");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  // capacity округляется вверх до степени двойки, но не меньше 2.
+  // length_error, если capacity больше max_size()
+  explicit mpmc_queue(size_type capacity);
+
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+  ~mpmc_queue();
+
+  size_type capacity() const noexcept { return mask_ + 1; }
+  // Наибольшая вместимость: старшая степень двойки, при которой кольцо
+  // еще умещается в адресное пространство
+  static constexpr size_type max_size() noexcept {
+    size_type limit = size_type(PTRDIFF_MAX) / sizeof(Cell);
+    size_type rounded = 1;
+    while (rounded <= limit / 2) rounded *= 2;
+    return rounded;
+  }
+  // Моментальный снимок, в многопоточной программе сразу устаревает
+  size_type size() const noexcept;
+  bool empty() const noexcept { return size() == 0; }
+
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+  template <typename... Args>
+  bool try_emplace(Args &&...args);
+  bool try_pop(value_type &value) noexcept;
+
+  // Ждут места или элемента; false - только после close()
+  bool push(const_reference value) { return emplace(value); }
+  bool push(value_type &&value) { return emplace(std::move(value)); }
+  template <typename... Args>
+  bool emplace(Args &&...args);
+  bool pop(value_type &value);
+
+  void close();
+  bool closed() const noexcept {
+    return closed_.load(std::memory_order_acquire);
+  }
+
+ private:
+  // Сколько раз push и pop уступают процессор, прежде чем уснуть: другая
+  // сторона обычно успевает освободить место или положить элемент
+  static constexpr int kSpinCount = 16;
+
+  struct Cell {
+    std::atomic<size_type> sequence_;
+    alignas(T) unsigned char data_[sizeof(T)];
+
+    T *value() noexcept {
+      return std::launder(reinterpret_cast<T *>(data_));
+    }
+  };
+
+  // Сами операции над кольцом, без пробуждения спящих потоков
+  template <typename... Args>
+  bool enqueue(Args &&...args);
+  bool dequeue(value_type &value) noexcept;
+  // Будит один поток, спящий в ожидании, если такой есть
+  void wakeOne(std::atomic<size_type> &waiters,
+               std::condition_variable &condition);
+
+  alignas(kCacheLineSize) std::atomic<size_type> head_{0};
+  alignas(kCacheLineSize) std::atomic<size_type> tail_{0};
+  // Редко меняющиеся данные отдельно от индексов: их читает каждая операция
+  alignas(kCacheLineSize) size_type mask_;
+  std::unique_ptr<Cell[]> cells_;
+  std::atomic<bool> closed_{false};
+  // Счетчики спящих потоков меняются при каждом засыпании, поэтому лежат
+  // на своей линии вместе с тем, что нужно только медленному пути
+  alignas(kCacheLineSize) std::atomic<size_type> pop_waiters_{0};
+  std::atomic<size_type> push_waiters_{0};
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+};
+
+template <typename T>
+mpmc_queue<T>::mpmc_queue(size_type capacity) {
+  // без проверки удвоение ниже переполнилось бы и не закончилось
+  if (capacity > max_size())
+    throw std::length_error("mpmc_queue::capacity is too big");
+  size_type rounded = 2;
+  while (rounded < capacity) rounded *= 2;
+  mask_ = rounded - 1;
+  cells_.reset(new Cell[rounded]);
+  for (size_type i = 0; i < rounded; ++i)
+    cells_[i].sequence_.store(i, std::memory_order_relaxed);
+}
+
+template <typename T>
+mpmc_queue<T>::~mpmc_queue() {
+  // других потоков уже нет: все занятые позиции заполнены
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  for (size_type pos = head_.load(std::memory_order_relaxed); pos != tail;
+       ++pos)
+    cells_[pos & mask_].value()->~T();
+}
+
+template <typename T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::size() const noexcept {
+  // head_ читается первым: tail_ не меньше любого прочитанного раньше head_
+  size_type head = head_.load(std::memory_order_acquire);
+  size_type tail = tail_.load(std::memory_order_acquire);
+  return std::min(tail - head, capacity());
+}
+
+template <typename T>
+template <typename... Args>
+bool mpmc_queue<T>::try_emplace(Args &&...args) {
+  bool pushed;
+  if constexpr (std::is_nothrow_constructible_v<T, Args...>) {
+    pushed = enqueue(std::forward<Args>(args)...);
+  } else {
+    // бросающий конструктор отрабатывает до того, как занята ячейка
+    if (size() > mask_) return false;
+    T value(std::forward<Args>(args)...);
+    pushed = enqueue(std::move(value));
+  }
+  if (pushed) wakeOne(pop_waiters_, not_empty_);
+  return pushed;
+}
+
+template <typename T>
+bool mpmc_queue<T>::try_pop(value_type &value) noexcept {
+  if (!dequeue(value)) return false;
+  wakeOne(push_waiters_, not_full_);
+  return true;
+}
+
+template <typename T>
+template <typename... Args>
+bool mpmc_queue<T>::enqueue(Args &&...args) {
+  if (closed_.load(std::memory_order_relaxed)) return false;
+  size_type pos = tail_.load(std::memory_order_relaxed);
+  Cell *cell;
+  for (;;) {
+    cell = &cells_[pos & mask_];
+    size_type sequence = cell->sequence_.load(std::memory_order_acquire);
+    std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) -
+                          static_cast<std::ptrdiff_t>(pos);
+    if (diff == 0) {
+      if (tail_.compare_exchange_weak(pos, pos + 1,
+                                      std::memory_order_relaxed))
+        break;
+    } else if (diff < 0) {
+      // читатель еще не освободил ячейку с прошлого круга
+      return false;
+    } else {
+      pos = tail_.load(std::memory_order_relaxed);
+    }
+  }
+  ::new (static_cast<void *>(cell->data_)) T(std::forward<Args>(args)...);
+  cell->sequence_.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+bool mpmc_queue<T>::dequeue(value_type &value) noexcept {
+  size_type pos = head_.load(std::memory_order_relaxed);
+  Cell *cell;
+  for (;;) {
+    cell = &cells_[pos & mask_];
+    size_type sequence = cell->sequence_.load(std::memory_order_acquire);
+    std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) -
+                          static_cast<std::ptrdiff_t>(pos + 1);
+    if (diff == 0) {
+      if (head_.compare_exchange_weak(pos, pos + 1,
+                                      std::memory_order_relaxed))
+        break;
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = head_.load(std::memory_order_relaxed);
+    }
+  }
+  value = std::move(*cell->value());
+  cell->value()->~T();
+  // ячейка свободна для писателя следующего круга
+  cell->sequence_.store(pos + mask_ + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+template <typename... Args>
+bool mpmc_queue<T>::emplace(Args &&...args) {
+  // аргументы используются один раз: ждем место, а затем переносим
+  // готовое значение
+  T value(std::forward<Args>(args)...);
+  for (int i = 0; i < kSpinCount; ++i) {
+    if (try_emplace(std::move(value))) return true;
+    if (closed()) return false;
+    std::this_thread::yield();
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  push_waiters_.fetch_add(1);
+  bool pushed;
+  while (!(pushed = enqueue(std::move(value))) &&
+         !closed_.load(std::memory_order_relaxed))
+    not_full_.wait(lock);
+  push_waiters_.fetch_sub(1);
+  // будить читателей можно только без мьютекса
+  lock.unlock();
+  if (pushed) wakeOne(pop_waiters_, not_empty_);
+  return pushed;
+}
+
+template <typename T>
+bool mpmc_queue<T>::pop(value_type &value) {
+  for (int i = 0; i < kSpinCount; ++i) {
+    bool was_closed = closed();
+    if (try_pop(value)) return true;
+    if (was_closed) return false;
+    std::this_thread::yield();
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  pop_waiters_.fetch_add(1);
+  bool popped;
+  for (;;) {
+    // флаг читается до попытки: элементы, положенные до close(), не теряются
+    bool was_closed = closed_.load(std::memory_order_acquire);
+    if ((popped = dequeue(value)) || was_closed) break;
+    not_empty_.wait(lock);
+  }
+  pop_waiters_.fetch_sub(1);
+  lock.unlock();
+  if (popped) wakeOne(push_waiters_, not_full_);
+  return popped;
+}
+
+template <typename T>
+void mpmc_queue<T>::close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_.store(true, std::memory_order_release);
+  }
+  not_empty_.notify_all();
+  not_full_.notify_all();
+}
+
+template <typename T>
+void mpmc_queue<T>::wakeOne(std::atomic<size_type> &waiters,
+                            std::condition_variable &condition) {
+  // Чтение через RMW, а не load: оно встает в один порядок изменений со
+  // счетчиком спящего потока. Либо здесь виден его fetch_add, либо он
+  // читает значение после этой операции и видит новое состояние ячейки.
+  // Барьер atomic_thread_fence дал бы то же, но его не понимает TSan
+  if (waiters.fetch_add(0, std::memory_order_acq_rel) == 0) return;
+  // мьютекс гарантирует, что проверивший очередь поток уже в wait
+  { std::lock_guard<std::mutex> lock(mutex_); }
+  condition.notify_one();
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_MPMC_QUEUE_H_
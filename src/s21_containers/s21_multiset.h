@@ -1,10 +1,17 @@
 #ifndef S21_CONTAINERSPLUS_S21_MULTISET_H
 #define S21_CONTAINERSPLUS_S21_MULTISET_H
 
+#include <memory_resource>
+
 #include "s21_tree.h"
 
 namespace s21 {
-template <class Key>
+// Compare - порядок элементов, Statistic - политика дерева(OrderStatistic
+// добавляет find_by_order и order_of_key), Allocator - откуда берется
+// память дерева(см. RBTree)
+template <class Key, class Compare = std::less<Key>,
+          class Statistic = NoOrderStatistic,
+          class Allocator = std::allocator<Key>>
 class multiset {
  public:
   // Тим элемента-ключ
@@ -17,133 +24,210 @@ class multiset {
   using const_reference = const value_type &;
   // Тип для размера контейнера
   using size_type = std::size_t;
+  // Аллокатор множества
+  using allocator_type = Allocator;
 
   // Внутренние классы
   //  1)дерева
-  using tree_type = RBTree<value_type>;
+  using tree_type =
+      RBTree<value_type, Compare, NodePool, Statistic, Allocator>;
   // 2)итератор
   using iterator = typename tree_type::iterator;
   // 3)константный итератор
   using const_iterator = typename tree_type::const_iterator;
+  // 4)извлеченный узел(node handle)
+  using node_type = typename tree_type::node_type;
 
   // конструктор по умолчанию, создает пустое множество
-  multiset() : tree_(new tree_type{}) {}
+  multiset() = default;
+
+  // пустое множество, память которого берется у alloc
+  explicit multiset(const allocator_type &alloc) : tree_(alloc) {}
 
   // конструктор создания множества(инициализация с помощью
   //  std::initializer_list)
-  multiset(std::initializer_list<value_type> const &items) : multiset() {
-    for (auto item : items) {
-      insert(item);
-    }
+  multiset(std::initializer_list<value_type> const &items,
+           const allocator_type &alloc = allocator_type())
+      : multiset(items.begin(), items.end(), alloc) {}
+
+  // конструктор из диапазона [first, last). Уже отсортированный диапазон
+  // превращается в дерево за линейное время
+  template <typename InputIt>
+  multiset(InputIt first, InputIt last,
+           const allocator_type &alloc = allocator_type())
+      : multiset(alloc) {
+    tree_.AssignRange(first, last, false);
   }
 
   // конструктор копирования
-  multiset(const multiset &m) : tree_(new tree_type(*m.tree_)) {}
+  multiset(const multiset &m) : tree_(m.tree_) {}
+
+  // копия m в памяти alloc
+  multiset(const multiset &m, const allocator_type &alloc)
+      : tree_(m.tree_, alloc) {}
 
   // оператор присваивания копированием
   multiset &operator=(const multiset &m) {
-    *tree_ = *m.tree_;
+    tree_ = m.tree_;
     return *this;
   }
 
   // конструктор переноса
-  multiset(multiset &&m) noexcept : tree_(new tree_type(std::move(*m.tree_))) {}
+  multiset(multiset &&m) noexcept : tree_(std::move(m.tree_)) {}
+
+  // перенос m в память alloc(элементы перемещаются, если аллокаторы не
+  // равны)
+  multiset(multiset &&m, const allocator_type &alloc)
+      : tree_(std::move(m.tree_), alloc) {}
 
   // оператор присваивания переносом
-  multiset &operator=(multiset &&m) noexcept {
-    *tree_ = std::move(*m.tree_);
+  multiset &operator=(multiset &&m) noexcept(kMoveStealsMemory<Allocator>) {
+    tree_ = std::move(m.tree_);
     return *this;
   }
 
-  // Деструктор
-  ~multiset() {
-    delete tree_;
-    // не забываем занулить
-    tree_ = nullptr;
+  // Аллокатор множества
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
   }
 
   // возвращает итератор в начало контейнера
-  iterator begin() noexcept { return tree_->begin_(); }
+  iterator begin() noexcept { return tree_.begin_(); }
 
   // тот же begin только для const
-  const_iterator begin() const noexcept { return tree_->begin_(); }
+  const_iterator begin() const noexcept { return tree_.begin_(); }
 
   // возвращает итератор на конец контейнера(после последнего элемента)
-  iterator end() noexcept { return tree_->end_(); }
+  iterator end() noexcept { return tree_.end_(); }
 
   // const версия для end()
-  const_iterator end() const noexcept { return tree_->end_(); }
+  const_iterator end() const noexcept { return tree_.end_(); }
 
   // Находит элемент с ключом эквивалентный ключу key
-  iterator find(const key_type &key) noexcept { return tree_->Find(key); }
+  iterator find(const key_type &key) noexcept { return tree_.Find(key); }
 
   // const версия для find()
   const_iterator find(const key_type &key) const noexcept {
-    return tree_->Find(key);
+    return tree_.Find(key);
   }
+
+  // find() по любому ключу K, сравнимому с элементами(например
+  // std::string_view для строк). Только для прозрачного Compare
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  iterator find(const K &key) noexcept {
+    return tree_.Find(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator find(const K &key) const noexcept {
+    return tree_.Find(key);
+  }
+
   // Вставляет значение value в контейнер(вставка выполняется по верхней
   // границе(если уже есть элементы с данным значением))
-  iterator insert(const value_type &value) { return tree_->InsertKey(value); }
+  iterator insert(const value_type &value) { return tree_.InsertKey(value); }
+
+  // Вставка с подсказкой: hint - позиция, перед которой должен оказаться
+  // элемент. При верной подсказке(например end() для неубывающих ключей)
+  // спуска от корня не будет
+  iterator insert(const_iterator hint, const value_type &value) {
+    return tree_.InsertKey(hint, value, false).first;
+  }
+
+  // Создает элемент из args и вставляет его с подсказкой hint
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return tree_.EmplaceHint(hint, false, std::forward<Args>(args)...).first;
+  }
+
+  // Извлекает узел на позиции pos из контейнера. Node handle владеет узлом
+  // сам, поэтому элемент из пула один раз переносится в отдельный узел
+  node_type extract(const_iterator pos) {
+    return tree_.Extract(pos);
+  }
+
+  // Извлекает первый узел с ключом key(пустой node_type, если ключа нет)
+  node_type extract(const key_type &key) {
+    return tree_.ExtractKey(key);
+  }
+
+  // Вставляет извлеченный узел без выделения памяти(по верхней границе)
+  iterator insert(node_type &&nh) { return tree_.InsertNode(nh, false).first; }
 
   // Возвращает кол-во элементов контейнера
-  size_type size() const noexcept { return tree_->_size_(); }
+  size_type size() const noexcept { return tree_._size_(); }
 
   // Возвращает true если контейнер пустой, false если нет
-  bool empty() const noexcept { return tree_->isEmpty(); }
+  bool empty() const noexcept { return tree_.isEmpty(); }
 
   // Возвращает максимально допустимое кол-во элементов в контейнере
-  size_type max_size() const noexcept { return tree_->maxSize(); }
+  size_type max_size() const noexcept { return tree_.maxSize(); }
 
   // очистка содержимого контейнера
-  void clear() noexcept { tree_->clear(); }
+  void clear() noexcept { tree_.clear(); }
 
   // удаляет элемент по передаваемой позиции ind
-  void erase(iterator pos) noexcept { tree_->Erase(pos); }
+  void erase(iterator pos) noexcept(!kCheckedIterators) {
+    tree_.Erase(pos);
+  }
 
   // Обменивает содержимое контейнера с other
-  void swap(multiset &other) noexcept { tree_->swap(*other.tree_); }
+  void swap(multiset &other) noexcept { tree_.swap(other.tree_); }
 
   // Вытаскиваем из other вставляем в контейнер. Если такой элемент есть-вставка
-  // не происходит
-  void merge(multiset &other) noexcept { tree_->Merge_(*other.tree_); }
+  // не происходит. Узлы перевешиваются без копирования, поэтому ссылки и
+  // указатели на перенесенные элементы остаются действительными. Только
+  // при разных аллокаторах элементы переносятся в новые узлы, и тогда
+  // возможно исключение
+  void merge(multiset &other) noexcept(
+      std::allocator_traits<allocator_type>::is_always_equal::value) {
+    tree_.Merge_(other.tree_);
+  }
+
+  // Операции над множествами. other поглощается целиком(после операции он
+  // пуст): его узлы переиспользуются или удаляются. При равных
+  // аллокаторах новых выделений нет. При разных элементы other сначала
+  // переносятся в новые узлы, и если это бросит исключение, оба
+  // контейнера не изменятся.
+  // Кратности элементов учитываются как в std::set_union,
+  // std::set_intersection и std::set_difference
+
+  // this = this ∪ other
+  void set_union(multiset &other) { tree_.SetUnion(other.tree_, false); }
+
+  // this = this ∩ other
+  void set_intersection(multiset &other) {
+    tree_.SetIntersection(other.tree_, false);
+  }
+
+  // this = this \ other
+  void set_difference(multiset &other) {
+    tree_.SetDifference(other.tree_, false);
+  }
 
   // Проверка на элемент с ключом key(true-да,false-нет)
   bool contains(const key_type &key) const noexcept {
-    return tree_->Find(key) != tree_->end_();
+    return tree_.Find(key) != tree_.end_();
   }
   // возвращает количество элементов с ключом, равным key
-  size_type count(const Key &key) const {
-    // находим первый элемент который не меньше ключа
-    auto iterator_lower = lower_bound(key);
-    if (*iterator_lower != key)
-      // если найденный элемент не равен ключу, значит кол-во таких элементов 0
-      return 0;
-    // если такой итератор равен key, то идем до тех пока, пока не встретим
-    // элемент больший чем key
-    auto iterator_end = end();
-    size_type res = 0;
-    while (iterator_lower != iterator_end && *iterator_lower == key) {
-      ++iterator_lower;
-      ++res;
-    }
-    // возвращаем количество итераций
-    return res;
+  size_type count(const key_type &key) const noexcept {
+    return tree_.CountKey(key);
   }
 
   // Итератор возвращает значение первого элемента меньшего чем подается в ключе
-  iterator lower_bound(const Key &key) noexcept { return tree_->LowBow(key); }
+  iterator lower_bound(const Key &key) noexcept { return tree_.LowBow(key); }
 
   // const версия итератора lower_bound
   const_iterator lower_bound(const Key &key) const noexcept {
-    return tree_->LowBow(key);
+    return tree_.LowBow(key);
   }
 
   // Итератор возвращает значение первого элемента большего чем подается в ключе
-  iterator upper_bound(const Key &key) noexcept { return tree_->UppBow(key); }
+  iterator upper_bound(const Key &key) noexcept { return tree_.UppBow(key); }
 
   // const версия итератора upper_bound
   const_iterator upper_bound(const Key &key) const noexcept {
-    return tree_->UppBow(key);
+    return tree_.UppBow(key);
   }
 
   // Возвращает диапазон, содержащий все элементы, эквивалентные value в
@@ -165,15 +249,78 @@ class multiset {
     return std::pair<const_iterator, const_iterator>(first, last);
   }
 
-  // Размещаем новые элементы в контейнер, если такого ключа еще нет
+  // Версии для ключа K при прозрачном Compare
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  bool contains(const K &key) const noexcept {
+    return tree_.Find(key) != tree_.end_();
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  size_type count(const K &key) const noexcept {
+    return tree_.CountKey(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  iterator lower_bound(const K &key) noexcept {
+    return tree_.LowBow(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator lower_bound(const K &key) const noexcept {
+    return tree_.LowBow(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  iterator upper_bound(const K &key) noexcept {
+    return tree_.UppBow(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator upper_bound(const K &key) const noexcept {
+    return tree_.UppBow(key);
+  }
+
+  // Возвращает итератор на k-й по порядку элемент(нумерация с нуля) или
+  // end(), если k >= size(). Только для политики OrderStatistic, O(log n)
+  iterator find_by_order(size_type k) noexcept {
+    return tree_.FindByOrder(k);
+  }
+
+  // const версия find_by_order()
+  const_iterator find_by_order(size_type k) const noexcept {
+    return static_cast<const tree_type &>(tree_).FindByOrder(k);
+  }
+
+  // Возвращает количество элементов меньших key(для повторяющихся ключей -
+  // позицию первого из них). Только для политики OrderStatistic, O(log n)
+  size_type order_of_key(const key_type &key) const noexcept {
+    return tree_.OrderOfKey(key);
+  }
+
+  // Создает элемент из аргументов конструктора args прямо в узле дерева и
+  // вставляет его(повторы ключей допускаются)
+  template <typename... Args>
+  iterator emplace(Args &&...args) {
+    return tree_.Emplace(false, std::forward<Args>(args)...).first;
+  }
+
+  // Вставляет каждый из args как отдельный элемент
   template <typename... Args>
-  std::vector<std::pair<iterator, bool>> emplace(Args &&...args) {
-    return tree_->emplace_(std::forward<Args>(args)...);
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    return tree_.InsertMany(false, std::forward<Args>(args)...);
   }
 
  private:
-  tree_type *tree_;
+  tree_type tree_;
 };
+
+namespace pmr {
+// multiset, вся память которого берется из std::pmr::memory_resource
+template <class Key, class Compare = std::less<Key>,
+          class Statistic = NoOrderStatistic>
+using multiset = s21::multiset<Key, Compare, Statistic,
+                               std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
 }  // namespace s21
 
 #endif  // S21_CONTAINERSPLUS_S21_MULTISET_H
\ No newline at end of file
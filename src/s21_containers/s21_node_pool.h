@@ -0,0 +1,251 @@
+#ifndef S21_CONTAINERS_S21_NODE_POOL_H
+#define S21_CONTAINERS_S21_NODE_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "s21_allocator.h"
+
+namespace s21 {
+
+// Пул узлов: память под узлы нарезается из непрерывных блоков(slab), а
+// освобожденные узлы складываются в односвязный список свободных ячеек и
+// переиспользуются при следующих вставках. Пул выдает только сырую память,
+// конструирование и разрушение значений остается на стороне контейнера.
+// Вся память возвращается одним проходом по блокам в release() и деструкторе.
+// Сами блоки берутся у Allocator(любого аллокатора, он перевязывается на
+// тип ячейки), например у арены std::pmr
+template <typename Node, typename Allocator = std::allocator<Node>>
+class NodePool {
+  union Slot;
+  using slot_allocator = rebind_alloc_t<Allocator, Slot>;
+  using slot_traits = std::allocator_traits<slot_allocator>;
+
+ public:
+  using value_type = Node;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  // Узлы одного пула нельзя отдавать в другой пул
+  using is_always_equal = std::false_type;
+  // release() освобождает всю память разом, даже если узлы не возвращались
+  static constexpr bool kBulkRelease = true;
+  // Узел живет внутри блока пула, отдать его наружу отдельно от пула нельзя
+  static constexpr bool kIndividualNodes = false;
+
+  NodePool() noexcept = default;
+
+  explicit NodePool(const allocator_type &alloc) noexcept : alloc_(alloc) {}
+
+  // Пул нельзя копировать: узлы принадлежат конкретному контейнеру
+  NodePool(const NodePool &) = delete;
+  NodePool &operator=(const NodePool &) = delete;
+
+  NodePool(NodePool &&other) noexcept : alloc_(other.alloc_) { swap(other); }
+
+  // Аллокаторы пулов должны быть равны
+  NodePool &operator=(NodePool &&other) noexcept {
+    if (this != &other) {
+      release();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~NodePool() { release(); }
+
+  // Выдает память под один узел: сначала из списка свободных ячеек,
+  // затем из текущего блока, и только если он закончился - новый блок
+  Node *allocate() {
+    if (free_ != nullptr) {
+      Slot *slot = free_;
+      free_ = slot->next_;
+      return reinterpret_cast<Node *>(slot);
+    }
+    if (cursor_ == end_) Grow(next_chunk_);
+    return reinterpret_cast<Node *>(cursor_++);
+  }
+
+  // Возвращает ячейку в список свободных(значение уже должно быть разрушено)
+  void deallocate(Node *node) noexcept {
+    Slot *slot = reinterpret_cast<Slot *>(node);
+    slot->next_ = free_;
+    free_ = slot;
+  }
+
+  // Гарантирует, что следующие count вызовов allocate() обойдутся без
+  // обращения к глобальной куче(одним блоком нужного размера)
+  void reserve(size_type count) {
+    size_type available = static_cast<size_type>(end_ - cursor_);
+    if (count > available) Grow(count);
+  }
+
+  // Освобождает все блоки разом
+  void release() noexcept {
+    while (chunks_ != nullptr) {
+      Slot *next = chunks_->chunk_.next_;
+      slot_traits::deallocate(alloc_, chunks_, chunks_->chunk_.size_);
+      chunks_ = next;
+    }
+    free_ = nullptr;
+    cursor_ = nullptr;
+    end_ = nullptr;
+    next_chunk_ = kFirstChunk;
+  }
+
+  // Забирает себе всю память other вместе с живыми узлами.
+  // Нужно, когда все узлы other переезжают в контейнер этого пула.
+  // Аллокаторы пулов должны быть равны
+  void merge(NodePool &other) noexcept {
+    if (this == &other || other.chunks_ == nullptr) return;
+    // неиспользованный хвост текущего блока other уходит в список свободных
+    while (other.cursor_ != other.end_)
+      other.deallocate(reinterpret_cast<Node *>(other.cursor_++));
+    Slot *last = other.chunks_;
+    while (last->chunk_.next_ != nullptr) last = last->chunk_.next_;
+    last->chunk_.next_ = chunks_;
+    chunks_ = other.chunks_;
+    if (other.free_ != nullptr) {
+      Slot *tail = other.free_;
+      while (tail->next_ != nullptr) tail = tail->next_;
+      tail->next_ = free_;
+      free_ = other.free_;
+    }
+    if (other.next_chunk_ > next_chunk_) next_chunk_ = other.next_chunk_;
+    other.chunks_ = nullptr;
+    other.free_ = nullptr;
+    other.cursor_ = nullptr;
+    other.end_ = nullptr;
+    other.next_chunk_ = kFirstChunk;
+  }
+
+  // Обмен памятью вместе с аллокаторами. Непереприсваиваемые аллокаторы
+  // (std::pmr) не распространяются, и у обменивающихся пулов они равны
+  void swap(NodePool &other) noexcept {
+    if constexpr (std::is_swappable<slot_allocator>::value) {
+      std::swap(alloc_, other.alloc_);
+    }
+    std::swap(chunks_, other.chunks_);
+    std::swap(free_, other.free_);
+    std::swap(cursor_, other.cursor_);
+    std::swap(end_, other.end_);
+    std::swap(next_chunk_, other.next_chunk_);
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(alloc_);
+  }
+
+  // Узел одного пула можно вернуть только в этот же пул
+  bool operator==(const NodePool &other) const noexcept {
+    return this == &other;
+  }
+
+  bool operator!=(const NodePool &other) const noexcept {
+    return this != &other;
+  }
+
+ private:
+  // Первая ячейка каждого блока: ссылка на следующий блок и размер блока
+  // в ячейках(нужен аллокатору при освобождении)
+  struct ChunkHeader {
+    Slot *next_;
+    size_type size_;
+  };
+
+  // Ячейка пула: либо узел, либо ссылка на следующую свободную ячейку,
+  // либо заголовок блока
+  union Slot {
+    Slot *next_;
+    ChunkHeader chunk_;
+    alignas(Node) unsigned char storage_[sizeof(Node)];
+  };
+
+  static constexpr size_type kFirstChunk = 32;
+  static constexpr size_type kMaxChunk = 16384;
+
+  // Выделяет новый блок на count узлов, остаток старого блока
+  // переносится в список свободных ячеек
+  void Grow(size_type count) {
+    Slot *chunk = slot_traits::allocate(alloc_, count + 1);
+    while (cursor_ != end_) deallocate(reinterpret_cast<Node *>(cursor_++));
+    chunk->chunk_.next_ = chunks_;
+    chunk->chunk_.size_ = count + 1;
+    chunks_ = chunk;
+    cursor_ = chunk + 1;
+    end_ = cursor_ + count;
+    if (next_chunk_ < kMaxChunk) next_chunk_ *= 2;
+  }
+
+  slot_allocator alloc_;
+  Slot *chunks_ = nullptr;
+  Slot *free_ = nullptr;
+  Slot *cursor_ = nullptr;
+  Slot *end_ = nullptr;
+  size_type next_chunk_ = kFirstChunk;
+};
+
+// Аллокатор без пула: каждый узел отдельно берется у Allocator и
+// возвращается ему же. Полезен, когда узлы часто переходят между
+// контейнерами: узлы взаимозаменяемы, если равны сами аллокаторы
+template <typename Node, typename Allocator = std::allocator<Node>>
+class NodeHeapAllocator {
+  using node_allocator = rebind_alloc_t<Allocator, Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+ public:
+  using value_type = Node;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  using is_always_equal = typename node_traits::is_always_equal;
+  static constexpr bool kBulkRelease = false;
+  // Каждый узел - отдельное выделение у Allocator: его можно отдать наружу
+  // (node handle) и освободить без этого объекта
+  static constexpr bool kIndividualNodes = true;
+
+  NodeHeapAllocator() noexcept = default;
+
+  explicit NodeHeapAllocator(const allocator_type &alloc) noexcept
+      : alloc_(alloc) {}
+
+  Node *allocate() { return node_traits::allocate(alloc_, 1); }
+
+  void deallocate(Node *node) noexcept {
+    node_traits::deallocate(alloc_, node, 1);
+  }
+
+  void reserve(size_type) noexcept {}
+
+  void release() noexcept {}
+
+  void merge(NodeHeapAllocator &) noexcept {}
+
+  void swap(NodeHeapAllocator &other) noexcept {
+    if constexpr (std::is_swappable<node_allocator>::value) {
+      std::swap(alloc_, other.alloc_);
+    }
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(alloc_);
+  }
+
+  bool operator==(const NodeHeapAllocator &other) const noexcept {
+    return alloc_ == other.alloc_;
+  }
+
+  bool operator!=(const NodeHeapAllocator &other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  node_allocator alloc_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_NODE_POOL_H
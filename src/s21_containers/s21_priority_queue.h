@@ -0,0 +1,562 @@
+#ifndef S21_CONTAINERS_S21_PRIORITY_QUEUE_H
+#define S21_CONTAINERS_S21_PRIORITY_QUEUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_allocator.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Операции над 4-арной кучей в массиве: дети позиции i лежат в позициях
+// 4i + 1 .. 4i + 4. Куча вдвое ниже двоичной, а четверо детей обычно
+// занимают одну линию кэша: подъем делает вдвое меньше сравнений, спуск -
+// столько же сравнений, но вдвое меньше переходов по памяти.
+// Элементы не меняются местами, а сдвигаются в "дырку", и новое значение
+// записывается один раз в конце. placed(i) вызывается для каждой позиции,
+// куда попал элемент(адресуемой куче это нужно, чтобы помнить позиции)
+struct QuaternaryHeap {
+  static constexpr std::size_t kArity = 4;
+
+  static std::size_t Parent(std::size_t i) noexcept {
+    return (i - 1) / kArity;
+  }
+
+  static std::size_t FirstChild(std::size_t i) noexcept {
+    return kArity * i + 1;
+  }
+
+  // Поднимает value из дырки hole, пока родитель уступает ему, но не выше
+  // позиции top
+  template <typename RandomIt, typename Value, typename Compare,
+            typename Placed>
+  static void SiftUp(RandomIt first, std::size_t hole, Value&& value,
+                     Compare& comp, Placed&& placed, std::size_t top = 0) {
+    while (hole > top) {
+      std::size_t parent = Parent(hole);
+      if (!comp(first[parent], value)) break;
+      first[hole] = std::move(first[parent]);
+      placed(hole);
+      hole = parent;
+    }
+    first[hole] = std::move(value);
+    placed(hole);
+  }
+
+  // Опускает value из дырки hole в куче из size элементов. Как в
+  // std::pop_heap, дырка сначала спускается до листа за старшим ребенком
+  // без сравнений с value, затем value поднимается от листа: value чаще
+  // всего взят с конца кучи и поднимается на шаг-два, а каждый уровень
+  // спуска экономит сравнение
+  template <typename RandomIt, typename Value, typename Compare,
+            typename Placed>
+  static void SiftDown(RandomIt first, std::size_t size, std::size_t hole,
+                       Value&& value, Compare& comp, Placed&& placed) {
+    std::size_t top = hole;
+    for (;;) {
+      std::size_t child = FirstChild(hole);
+      if (child >= size) break;
+      // внуки(kArity * kArity подряд) понадобятся на следующем уровне:
+      // загрузка их линий кэша идет, пока выбирается старший ребенок
+      std::size_t grandchild = FirstChild(child);
+      if (grandchild < size) {
+        __builtin_prefetch(&first[grandchild]);
+        __builtin_prefetch(
+            &first[std::min(grandchild + kArity * kArity, size) - 1]);
+      }
+      std::size_t best = child + BestChild(first + child, size - child, comp);
+      first[hole] = std::move(first[best]);
+      placed(hole);
+      hole = best;
+    }
+    SiftUp(first, hole, std::forward<Value>(value), comp, placed, top);
+  }
+
+  // Старший из count(не больше kArity) детей, начиная с children. Четверо
+  // детей сравниваются парами, чтобы сравнения не зависели друг от друга
+  template <typename RandomIt, typename Compare>
+  static std::size_t BestChild(RandomIt children, std::size_t count,
+                               Compare& comp) {
+    if (count >= kArity) {
+      std::size_t left = comp(children[0], children[1]) ? 1 : 0;
+      std::size_t right = comp(children[2], children[3]) ? 3 : 2;
+      return comp(children[left], children[right]) ? right : left;
+    }
+    std::size_t best = 0;
+    for (std::size_t i = 1; i < count; ++i)
+      if (comp(children[best], children[i])) best = i;
+    return best;
+  }
+
+  // Построение за O(n): внутренние узлы опускаются снизу вверх
+  template <typename RandomIt, typename Compare, typename Placed>
+  static void Make(RandomIt first, std::size_t size, Compare& comp,
+                   Placed&& placed) {
+    if (size < 2) return;
+    for (std::size_t i = Parent(size - 1) + 1; i-- > 0;) {
+      typename std::iterator_traits<RandomIt>::value_type value =
+          std::move(first[i]);
+      SiftDown(first, size, i, std::move(value), comp, placed);
+    }
+  }
+
+  struct NoPlaced {
+    void operator()(std::size_t) const noexcept {}
+  };
+};
+
+// Адаптер очереди с приоритетом над Container, как std::priority_queue:
+// top() - наибольший по Compare элемент(с std::greater - наименьший).
+// Внутри 4-арная куча QuaternaryHeap. Container - s21::vector или другой
+// контейнер с итераторами произвольного доступа, front, back, push_back,
+// emplace_back, pop_back, swap и get_allocator
+template <typename T, typename Container = vector<T>,
+          typename Compare = std::less<typename Container::value_type>>
+class priority_queue {
+ public:
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using allocator_type = typename Container::allocator_type;
+
+  priority_queue() = default;
+  explicit priority_queue(const allocator_type& alloc);
+  // Элементы container упорядочиваются в кучу за O(n)
+  explicit priority_queue(const Compare& comp,
+                          const container_type& container = container_type());
+  priority_queue(const Compare& comp, container_type&& container);
+  template <typename InputIt>
+  priority_queue(InputIt first, InputIt last, const Compare& comp = Compare());
+  priority_queue(std::initializer_list<T> const& items,
+                 const Compare& comp = Compare());
+
+  const_reference top() const;
+  bool empty() const;
+  size_type size() const;
+  void push(const_reference value);
+  void push(value_type&& value);
+  template <class... Args>
+  void emplace(Args&&... args);
+  template <class... Args>
+  void insert_many(Args&&... args);
+  void pop();
+  void swap(priority_queue& other);
+  allocator_type get_allocator() const;
+
+ private:
+  void siftUpLast();
+  void heapify();
+
+  container_type container_;
+  Compare comp_;
+};
+
+template <typename T, typename Container, typename Compare>
+priority_queue<T, Container, Compare>::priority_queue(
+    const allocator_type& alloc)
+    : container_(alloc) {}
+
+template <typename T, typename Container, typename Compare>
+priority_queue<T, Container, Compare>::priority_queue(
+    const Compare& comp, const container_type& container)
+    : container_(container), comp_(comp) {
+  heapify();
+}
+
+template <typename T, typename Container, typename Compare>
+priority_queue<T, Container, Compare>::priority_queue(
+    const Compare& comp, container_type&& container)
+    : container_(std::move(container)), comp_(comp) {
+  heapify();
+}
+
+template <typename T, typename Container, typename Compare>
+template <typename InputIt>
+priority_queue<T, Container, Compare>::priority_queue(InputIt first,
+                                                      InputIt last,
+                                                      const Compare& comp)
+    : comp_(comp) {
+  for (; first != last; ++first) container_.push_back(*first);
+  heapify();
+}
+
+template <typename T, typename Container, typename Compare>
+priority_queue<T, Container, Compare>::priority_queue(
+    std::initializer_list<T> const& items, const Compare& comp)
+    : priority_queue(items.begin(), items.end(), comp) {}
+
+template <typename T, typename Container, typename Compare>
+typename priority_queue<T, Container, Compare>::const_reference
+priority_queue<T, Container, Compare>::top() const {
+  return container_.front();
+}
+
+template <typename T, typename Container, typename Compare>
+bool priority_queue<T, Container, Compare>::empty() const {
+  return container_.empty();
+}
+
+template <typename T, typename Container, typename Compare>
+typename priority_queue<T, Container, Compare>::size_type
+priority_queue<T, Container, Compare>::size() const {
+  return container_.size();
+}
+
+template <typename T, typename Container, typename Compare>
+void priority_queue<T, Container, Compare>::push(const_reference value) {
+  container_.push_back(value);
+  siftUpLast();
+}
+
+template <typename T, typename Container, typename Compare>
+void priority_queue<T, Container, Compare>::push(value_type&& value) {
+  container_.push_back(std::move(value));
+  siftUpLast();
+}
+
+template <typename T, typename Container, typename Compare>
+template <class... Args>
+void priority_queue<T, Container, Compare>::emplace(Args&&... args) {
+  container_.emplace_back(std::forward<Args>(args)...);
+  siftUpLast();
+}
+
+template <typename T, typename Container, typename Compare>
+template <class... Args>
+void priority_queue<T, Container, Compare>::insert_many(Args&&... args) {
+  // много элементов сразу дешевле уложить заново, чем поднимать по одному
+  size_type old_size = container_.size();
+  try {
+    (container_.emplace_back(std::forward<Args>(args)), ...);
+  } catch (...) {
+    // уже добавленные элементы еще не в куче: убираем их, куча прежняя
+    while (container_.size() > old_size) container_.pop_back();
+    throw;
+  }
+  if (sizeof...(args) > old_size) {
+    heapify();
+  } else {
+    for (size_type i = old_size; i < container_.size(); ++i) {
+      T value = std::move(container_.begin()[i]);
+      QuaternaryHeap::SiftUp(container_.begin(), i, std::move(value), comp_,
+                             QuaternaryHeap::NoPlaced());
+    }
+  }
+}
+
+template <typename T, typename Container, typename Compare>
+void priority_queue<T, Container, Compare>::pop() {
+  // последний элемент переносится в корень и опускается на место
+  T last = std::move(container_.back());
+  container_.pop_back();
+  if (!container_.empty())
+    QuaternaryHeap::SiftDown(container_.begin(), container_.size(), 0,
+                             std::move(last), comp_,
+                             QuaternaryHeap::NoPlaced());
+}
+
+template <typename T, typename Container, typename Compare>
+void priority_queue<T, Container, Compare>::swap(priority_queue& other) {
+  using std::swap;
+  container_.swap(other.container_);
+  swap(comp_, other.comp_);
+}
+
+template <typename T, typename Container, typename Compare>
+typename priority_queue<T, Container, Compare>::allocator_type
+priority_queue<T, Container, Compare>::get_allocator() const {
+  return container_.get_allocator();
+}
+
+template <typename T, typename Container, typename Compare>
+void priority_queue<T, Container, Compare>::siftUpLast() {
+  size_type hole = container_.size() - 1;
+  T value = std::move(container_.begin()[hole]);
+  QuaternaryHeap::SiftUp(container_.begin(), hole, std::move(value), comp_,
+                         QuaternaryHeap::NoPlaced());
+}
+
+template <typename T, typename Container, typename Compare>
+void priority_queue<T, Container, Compare>::heapify() {
+  QuaternaryHeap::Make(container_.begin(), container_.size(), comp_,
+                       QuaternaryHeap::NoPlaced());
+}
+
+// Очередь с приоритетом, элемент которой можно найти по описателю,
+// полученному из push: поменять ему приоритет или удалить его за
+// O(log n). Та же 4-арная куча, но каждый элемент хранит свой описатель, а
+// positions_ - позицию в куче по описателю. Описатель удаленного элемента
+// может быть выдан снова, как номер файлового дескриптора
+template <typename T, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<T>>
+class addressable_priority_queue {
+ public:
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using handle_type = size_t;
+
+  addressable_priority_queue() = default;
+  explicit addressable_priority_queue(const allocator_type& alloc);
+  explicit addressable_priority_queue(
+      const Compare& comp, const allocator_type& alloc = allocator_type());
+
+  const_reference top() const;
+  handle_type top_handle() const;
+  bool empty() const { return heap_.empty(); }
+  size_type size() const { return heap_.size(); }
+  bool contains(handle_type handle) const;
+  // Элемент по описателю; описатель должен быть в очереди
+  const_reference value(handle_type handle) const;
+
+  handle_type push(const_reference value);
+  handle_type push(value_type&& value);
+  template <class... Args>
+  handle_type emplace(Args&&... args);
+  void pop();
+  // Повышает приоритет: новое значение не должно уступать старому по
+  // Compare, элемент только поднимается. С std::less по умолчанию значение
+  // растет, с std::greater(очередь минимумов) это уменьшение ключа
+  void promote(handle_type handle, value_type value);
+  // Новое значение любое: элемент поднимается или опускается
+  void update(handle_type handle, value_type value);
+  void erase(handle_type handle);
+  void clear() noexcept;
+  void reserve(size_type capacity);
+  allocator_type get_allocator() const { return heap_.get_allocator(); }
+
+ private:
+  static constexpr size_type kNoPosition = size_type(-1);
+
+  struct Entry {
+    T value_;
+    handle_type handle_;
+  };
+
+  // Сравнение элементов кучи по значениям
+  struct EntryCompare {
+    bool operator()(const Entry& a, const Entry& b) {
+      return comp_(a.value_, b.value_);
+    }
+    Compare comp_;
+  };
+
+  // Записывает в positions_ новую позицию переехавшего элемента
+  struct Placed {
+    void operator()(size_type index) const noexcept {
+      (*positions_)[(*heap_)[index].handle_] = index;
+    }
+    const vector<Entry, DoublingGrowth, rebind_alloc_t<Allocator, Entry>>*
+        heap_;
+    vector<size_type, DoublingGrowth, rebind_alloc_t<Allocator, size_type>>*
+        positions_;
+  };
+
+  handle_type acquireHandle();
+  size_type checkedPosition(handle_type handle) const;
+  void siftUp(size_type hole, Entry&& entry);
+  void siftDown(size_type hole, Entry&& entry);
+  // Удаляет элемент в позиции index, закрывая дырку последним элементом
+  void removeAt(size_type index);
+  Placed placed() { return Placed{&heap_, &positions_}; }
+
+  vector<Entry, DoublingGrowth, rebind_alloc_t<Allocator, Entry>> heap_;
+  // Позиция в heap_ по описателю, kNoPosition - описатель свободен
+  vector<size_type, DoublingGrowth, rebind_alloc_t<Allocator, size_type>>
+      positions_;
+  vector<handle_type, DoublingGrowth, rebind_alloc_t<Allocator, handle_type>>
+      free_handles_;
+  EntryCompare comp_;
+};
+
+template <typename T, typename Compare, typename Allocator>
+addressable_priority_queue<T, Compare, Allocator>::addressable_priority_queue(
+    const allocator_type& alloc)
+    : heap_(alloc), positions_(alloc), free_handles_(alloc) {}
+
+template <typename T, typename Compare, typename Allocator>
+addressable_priority_queue<T, Compare, Allocator>::addressable_priority_queue(
+    const Compare& comp, const allocator_type& alloc)
+    : heap_(alloc), positions_(alloc), free_handles_(alloc), comp_{comp} {}
+
+template <typename T, typename Compare, typename Allocator>
+typename addressable_priority_queue<T, Compare, Allocator>::const_reference
+addressable_priority_queue<T, Compare, Allocator>::top() const {
+  return heap_.front().value_;
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename addressable_priority_queue<T, Compare, Allocator>::handle_type
+addressable_priority_queue<T, Compare, Allocator>::top_handle() const {
+  return heap_.front().handle_;
+}
+
+template <typename T, typename Compare, typename Allocator>
+bool addressable_priority_queue<T, Compare, Allocator>::contains(
+    handle_type handle) const {
+  return handle < positions_.size() && positions_[handle] != kNoPosition;
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename addressable_priority_queue<T, Compare, Allocator>::const_reference
+addressable_priority_queue<T, Compare, Allocator>::value(
+    handle_type handle) const {
+  return heap_[checkedPosition(handle)].value_;
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename addressable_priority_queue<T, Compare, Allocator>::handle_type
+addressable_priority_queue<T, Compare, Allocator>::push(
+    const_reference value) {
+  return emplace(value);
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename addressable_priority_queue<T, Compare, Allocator>::handle_type
+addressable_priority_queue<T, Compare, Allocator>::push(value_type&& value) {
+  return emplace(std::move(value));
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <class... Args>
+typename addressable_priority_queue<T, Compare, Allocator>::handle_type
+addressable_priority_queue<T, Compare, Allocator>::emplace(Args&&... args) {
+  handle_type handle = acquireHandle();
+  try {
+    heap_.push_back(Entry{T(std::forward<Args>(args)...), handle});
+  } catch (...) {
+    free_handles_.push_back(handle);
+    throw;
+  }
+  Entry entry = std::move(heap_.back());
+  siftUp(heap_.size() - 1, std::move(entry));
+  return handle;
+}
+
+template <typename T, typename Compare, typename Allocator>
+void addressable_priority_queue<T, Compare, Allocator>::pop() {
+  if (heap_.empty())
+    throw std::logic_error("addressable_priority_queue::queue is empty");
+  removeAt(0);
+}
+
+template <typename T, typename Compare, typename Allocator>
+void addressable_priority_queue<T, Compare, Allocator>::promote(
+    handle_type handle, value_type value) {
+  size_type index = checkedPosition(handle);
+  if (comp_.comp_(value, heap_[index].value_))
+    throw std::invalid_argument(
+        "addressable_priority_queue::promote lowers the priority");
+  siftUp(index, Entry{std::move(value), handle});
+}
+
+template <typename T, typename Compare, typename Allocator>
+void addressable_priority_queue<T, Compare, Allocator>::update(
+    handle_type handle, value_type value) {
+  size_type index = checkedPosition(handle);
+  if (comp_.comp_(heap_[index].value_, value))
+    siftUp(index, Entry{std::move(value), handle});
+  else
+    siftDown(index, Entry{std::move(value), handle});
+}
+
+template <typename T, typename Compare, typename Allocator>
+void addressable_priority_queue<T, Compare, Allocator>::erase(
+    handle_type handle) {
+  removeAt(checkedPosition(handle));
+}
+
+template <typename T, typename Compare, typename Allocator>
+void addressable_priority_queue<T, Compare, Allocator>::clear() noexcept {
+  heap_.clear();
+  positions_.clear();
+  free_handles_.clear();
+}
+
+template <typename T, typename Compare, typename Allocator>
+void addressable_priority_queue<T, Compare, Allocator>::reserve(
+    size_type capacity) {
+  heap_.reserve(capacity);
+  positions_.reserve(capacity);
+  free_handles_.reserve(capacity);
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename addressable_priority_queue<T, Compare, Allocator>::handle_type
+addressable_priority_queue<T, Compare, Allocator>::acquireHandle() {
+  // место под описатель в free_handles_ резервируется заранее, чтобы
+  // вернуть его туда без выделения памяти
+  free_handles_.reserve(positions_.size() + 1);
+  if (free_handles_.empty()) {
+    positions_.push_back(kNoPosition);
+    return positions_.size() - 1;
+  }
+  handle_type handle = free_handles_.back();
+  free_handles_.pop_back();
+  return handle;
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename addressable_priority_queue<T, Compare, Allocator>::size_type
+addressable_priority_queue<T, Compare, Allocator>::checkedPosition(
+    handle_type handle) const {
+  if (!contains(handle))
+    throw std::out_of_range("addressable_priority_queue::unknown handle");
+  return positions_[handle];
+}
+
+template <typename T, typename Compare, typename Allocator>
+void addressable_priority_queue<T, Compare, Allocator>::siftUp(
+    size_type hole, Entry&& entry) {
+  QuaternaryHeap::SiftUp(heap_.begin(), hole, std::move(entry), comp_,
+                         placed());
+}
+
+template <typename T, typename Compare, typename Allocator>
+void addressable_priority_queue<T, Compare, Allocator>::siftDown(
+    size_type hole, Entry&& entry) {
+  QuaternaryHeap::SiftDown(heap_.begin(), heap_.size(), hole,
+                           std::move(entry), comp_, placed());
+}
+
+template <typename T, typename Compare, typename Allocator>
+void addressable_priority_queue<T, Compare, Allocator>::removeAt(
+    size_type index) {
+  positions_[heap_[index].handle_] = kNoPosition;
+  free_handles_.push_back(heap_[index].handle_);
+  Entry last = std::move(heap_.back());
+  heap_.pop_back();
+  if (index == heap_.size()) return;
+  // последний элемент может оказаться и больше, и меньше соседей удаленного
+  if (index > 0 && comp_(heap_[QuaternaryHeap::Parent(index)], last))
+    siftUp(index, std::move(last));
+  else
+    siftDown(index, std::move(last));
+}
+
+namespace pmr {
+// priority_queue, элементы которого берутся из std::pmr::memory_resource
+template <typename T, typename Compare = std::less<T>>
+using priority_queue = s21::priority_queue<T, pmr::vector<T>, Compare>;
+
+template <typename T, typename Compare = std::less<T>>
+using addressable_priority_queue =
+    s21::addressable_priority_queue<T, Compare,
+                                    std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+}  // namespace s21
+#endif  // S21_CONTAINERS_S21_PRIORITY_QUEUE_H
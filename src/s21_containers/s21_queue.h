@@ -2,24 +2,42 @@
 #define S21_CONTAINERS_S21_QUEUE_H
 
 #include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
 
 #include "s21_list.h"
+#include "s21_ring_buffer.h"
 
 namespace s21 {
-template <typename T>
+// Адаптер очереди над Container, как у стандартных адаптеров. По умолчанию
+// элементы лежат в кольцевом буфере s21::ring_buffer; подойдет и
+// s21::list(нужны front, back, push_back, emplace_back, pop_front,
+// insert_many_back, swap и get_allocator)
+template <typename T, typename Container = ring_buffer<T>>
 class queue {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
   using size_type = size_t;
+  using allocator_type = typename Container::allocator_type;
 
   queue() = default;
+  explicit queue(const allocator_type& alloc);
+  explicit queue(const container_type& container);
+  explicit queue(container_type&& container);
   queue(const queue& other);
-  queue(std::initializer_list<value_type> const& items);
-  queue(queue&& other) noexcept;
+  queue(const queue& other, const allocator_type& alloc);
+  queue(std::initializer_list<value_type> const& items,
+        const allocator_type& alloc = allocator_type());
+  queue(queue&& other) noexcept(
+      std::is_nothrow_move_constructible_v<Container>);
+  queue(queue&& other, const allocator_type& alloc);
   queue& operator=(const queue& other);
-  queue& operator=(queue&& other) noexcept;
+  queue& operator=(queue&& other) noexcept(
+      std::is_nothrow_move_assignable_v<Container>);
   ~queue();
 
   const_reference front();
@@ -27,82 +45,134 @@ class queue {
   bool empty() const;
   size_type size() const;
   void push(const_reference value);
+  void push(value_type&& value);
   void pop();
   void swap(queue& other);
+  allocator_type get_allocator() const;
   template <class... Args>
   void emplace_back(Args&&... args);
+  template <class... Args>
+  void insert_many_back(Args&&... args);
 
  private:
-  list<value_type> list_;
+  container_type container_;
 };
 
-template <typename T>
-queue<T>::queue(const queue& other) : list_{other.list_} {}
+template <typename T, typename Container>
+queue<T, Container>::queue(const allocator_type& alloc) : container_(alloc) {}
 
-template <typename T>
-queue<T>::queue(std::initializer_list<T> const& items) : list_{items} {}
+template <typename T, typename Container>
+queue<T, Container>::queue(const container_type& container)
+    : container_(container) {}
 
-template <typename T>
-queue<T>::queue(queue&& other) noexcept : list_{std::move(other.list_)} {}
+template <typename T, typename Container>
+queue<T, Container>::queue(container_type&& container)
+    : container_(std::move(container)) {}
 
-template <typename T>
-queue<T>& queue<T>::operator=(const queue& other) {
+template <typename T, typename Container>
+queue<T, Container>::queue(const queue& other)
+    : container_{other.container_} {}
+
+template <typename T, typename Container>
+queue<T, Container>::queue(const queue& other, const allocator_type& alloc)
+    : container_(other.container_, alloc) {}
+
+template <typename T, typename Container>
+queue<T, Container>::queue(std::initializer_list<T> const& items,
+                           const allocator_type& alloc)
+    : container_(items, alloc) {}
+
+template <typename T, typename Container>
+queue<T, Container>::queue(queue&& other) noexcept(
+    std::is_nothrow_move_constructible_v<Container>)
+    : container_{std::move(other.container_)} {}
+
+template <typename T, typename Container>
+queue<T, Container>::queue(queue&& other, const allocator_type& alloc)
+    : container_(std::move(other.container_), alloc) {}
+
+template <typename T, typename Container>
+queue<T, Container>& queue<T, Container>::operator=(const queue& other) {
   if (this != &other) {
     queue(other).swap(*this);
   }
   return *this;
 }
 
-template <typename T>
-queue<T>& queue<T>::operator=(queue&& other) noexcept {
+template <typename T, typename Container>
+queue<T, Container>& queue<T, Container>::operator=(queue&& other) noexcept(
+    std::is_nothrow_move_assignable_v<Container>) {
   if (this != &other) {
-    list_ = std::move(other.list_);
+    container_ = std::move(other.container_);
   }
   return *this;
 }
 
-template <typename T>
-queue<T>::~queue() {}
+template <typename T, typename Container>
+queue<T, Container>::~queue() {}
 
-template <typename T>
-const T& queue<T>::front() {
-  return list_.front();
+template <typename T, typename Container>
+const T& queue<T, Container>::front() {
+  return container_.front();
 }
 
-template <typename T>
-const T& queue<T>::back() {
-  return list_.back();
+template <typename T, typename Container>
+const T& queue<T, Container>::back() {
+  return container_.back();
 }
 
-template <typename T>
-bool queue<T>::empty() const {
-  return list_.empty();
+template <typename T, typename Container>
+bool queue<T, Container>::empty() const {
+  return container_.empty();
 }
 
-template <typename T>
-typename queue<T>::size_type queue<T>::size() const {
-  return list_.size();
+template <typename T, typename Container>
+typename queue<T, Container>::size_type queue<T, Container>::size() const {
+  return container_.size();
 }
 
-template <typename T>
-void queue<T>::push(const_reference value) {
-  list_.push_back(value);
+template <typename T, typename Container>
+void queue<T, Container>::push(const_reference value) {
+  container_.push_back(value);
 }
 
-template <typename T>
-void queue<T>::pop() {
-  list_.pop_front();
+template <typename T, typename Container>
+void queue<T, Container>::push(value_type&& value) {
+  container_.push_back(std::move(value));
 }
 
-template <typename T>
-void queue<T>::swap(queue& other) {
-  list_.swap(other.list_);
+template <typename T, typename Container>
+void queue<T, Container>::pop() {
+  container_.pop_front();
 }
 
-template <typename T>
+template <typename T, typename Container>
+void queue<T, Container>::swap(queue& other) {
+  container_.swap(other.container_);
+}
+
+template <typename T, typename Container>
+typename queue<T, Container>::allocator_type
+queue<T, Container>::get_allocator() const {
+  return container_.get_allocator();
+}
+
+template <typename T, typename Container>
 template <class... Args>
-void queue<T>::emplace_back(Args&&... args) {
-  list_.emplace_back(std::forward<Args>(args)...);
+void queue<T, Container>::emplace_back(Args&&... args) {
+  container_.emplace_back(std::forward<Args>(args)...);
 }
+
+template <typename T, typename Container>
+template <class... Args>
+void queue<T, Container>::insert_many_back(Args&&... args) {
+  container_.insert_many_back(std::forward<Args>(args)...);
+}
+
+namespace pmr {
+// queue, элементы которого берутся из std::pmr::memory_resource
+template <typename T>
+using queue = s21::queue<T, pmr::ring_buffer<T>>;
+}  // namespace pmr
 }  // namespace s21
 #endif  // S21_CONTAINERS_S21_QUEUE_H
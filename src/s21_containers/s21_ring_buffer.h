@@ -0,0 +1,373 @@
+#ifndef S21_CONTAINERS_S21_RING_BUFFER_H_
+#define S21_CONTAINERS_S21_RING_BUFFER_H_
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_allocator.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Кольцевой буфер в непрерывной памяти: вставка и удаление с обоих концов
+// за O(1) без выделения памяти на каждый элемент. Емкость - степень двойки,
+// поэтому позиция элемента получается маской индекса, а не делением.
+// При заполнении буфер растет вдвое, элементы переезжают в начало нового
+// буфера. Хранилище по умолчанию для s21::queue и s21::stack
+template <typename T, typename Allocator = std::allocator<T>>
+class ring_buffer : private AllocatorStorage<Allocator> {
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using storage = AllocatorStorage<Allocator>;
+
+  static_assert(std::is_same_v<typename alloc_traits::value_type, T>,
+                "ring_buffer::Allocator::value_type must be T");
+  static_assert(std::is_same_v<typename alloc_traits::pointer, T *>,
+                "ring_buffer::Allocator must use raw pointers");
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using size_type = std::size_t;
+
+  ring_buffer() noexcept(noexcept(Allocator())) = default;
+
+  explicit ring_buffer(const allocator_type &alloc) noexcept
+      : storage(alloc) {}
+
+  ring_buffer(std::initializer_list<value_type> const &items,
+              const allocator_type &alloc = allocator_type())
+      : storage(alloc) {
+    reserve(items.size());
+    for (const auto &item : items) emplace_back(item);
+  }
+
+  // Копия получает аллокатор от select_on_container_copy_construction
+  ring_buffer(const ring_buffer &other)
+      : ring_buffer(other,
+                    alloc_traits::select_on_container_copy_construction(
+                        other.allocator())) {}
+
+  ring_buffer(const ring_buffer &other, const allocator_type &alloc)
+      : storage(alloc) {
+    reserve(other.size_);
+    for (size_type i = 0; i < other.size_; ++i) emplace_back(other[i]);
+  }
+
+  ring_buffer(ring_buffer &&other) noexcept : storage(other.allocator()) {
+    swapBuffers(other);
+  }
+
+  // Буфер other забирается, только если alloc может его освободить, иначе
+  // элементы переносятся по одному
+  ring_buffer(ring_buffer &&other, const allocator_type &alloc)
+      : storage(alloc) {
+    if (allocator() == other.allocator()) {
+      swapBuffers(other);
+    } else {
+      moveElementsFrom(other);
+    }
+  }
+
+  ~ring_buffer() { release(); }
+
+  ring_buffer &operator=(const ring_buffer &other) {
+    if (this != &other) {
+      constexpr bool propagate =
+          alloc_traits::propagate_on_container_copy_assignment::value;
+      ring_buffer tmp(other,
+                      propagate ? other.get_allocator() : get_allocator());
+      swapBuffers(tmp);
+      if constexpr (propagate) {
+        using std::swap;
+        swap(allocator(), tmp.allocator());
+      }
+    }
+    return *this;
+  }
+
+  // Буфер other переходит к *this без копирования, если аллокаторы равны
+  // или аллокатор переходит вместе с ним
+  ring_buffer &operator=(ring_buffer &&other) noexcept(
+      kMoveStealsMemory<Allocator>) {
+    if (this == &other) return *this;
+    if constexpr (kMoveStealsMemory<Allocator>) {
+      stealBuffer(other);
+    } else if (allocator() == other.allocator()) {
+      stealBuffer(other);
+    } else {
+      clear();
+      moveElementsFrom(other);
+    }
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept { return allocator(); }
+
+  // i-й элемент от начала(front() - нулевой), без проверки границ
+  reference operator[](size_type i) noexcept {
+    return buffer_[(head_ + i) & (capacity_ - 1)];
+  }
+
+  const_reference operator[](size_type i) const noexcept {
+    return buffer_[(head_ + i) & (capacity_ - 1)];
+  }
+
+  reference front() {
+    if (size_ == 0) throw std::logic_error("ring_buffer::container is empty");
+    return buffer_[head_];
+  }
+
+  const_reference front() const {
+    if (size_ == 0) throw std::logic_error("ring_buffer::container is empty");
+    return buffer_[head_];
+  }
+
+  reference back() {
+    if (size_ == 0) throw std::logic_error("ring_buffer::container is empty");
+    return (*this)[size_ - 1];
+  }
+
+  const_reference back() const {
+    if (size_ == 0) throw std::logic_error("ring_buffer::container is empty");
+    return (*this)[size_ - 1];
+  }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+
+  // Емкость округляется вверх до степени двойки
+  void reserve(size_type count) {
+    if (count > capacity_) reallocate(roundCapacity(count));
+  }
+
+  void clear() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (size_type i = 0; i < size_; ++i) destroyAt(&(*this)[i]);
+    }
+    head_ = 0;
+    size_ = 0;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  void push_front(const_reference value) { emplace_front(value); }
+
+  void push_front(value_type &&value) { emplace_front(std::move(value)); }
+
+  // Элемент создается на месте. При росте новый элемент создается раньше,
+  // чем переезжают старые, поэтому args может ссылаться на элемент буфера
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      growWith(size_, std::forward<Args>(args)...);
+    } else {
+      constructAt(&(*this)[size_], std::forward<Args>(args)...);
+    }
+    return (*this)[size_++];
+  }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    if (size_ == capacity_) {
+      // новый элемент ляжет в последнюю ячейку нового буфера
+      growWith(capacity_ == 0 ? kMinCapacity - 1 : capacity_ * 2 - 1,
+               std::forward<Args>(args)...);
+      head_ = capacity_ - 1;
+    } else {
+      head_ = (head_ - 1) & (capacity_ - 1);
+      try {
+        constructAt(buffer_ + head_, std::forward<Args>(args)...);
+      } catch (...) {
+        head_ = (head_ + 1) & (capacity_ - 1);
+        throw;
+      }
+    }
+    ++size_;
+    return buffer_[head_];
+  }
+
+  // Удаление из пустого буфера ничего не делает(как у s21::list)
+  void pop_front() noexcept {
+    if (size_ == 0) return;
+    destroyAt(buffer_ + head_);
+    head_ = (head_ + 1) & (capacity_ - 1);
+    --size_;
+  }
+
+  void pop_back() noexcept {
+    if (size_ == 0) return;
+    destroyAt(&(*this)[size_ - 1]);
+    --size_;
+  }
+
+  // Каждый из args - отдельный элемент в конце
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (emplace_back(std::forward<Args>(args)), ...);
+  }
+
+  // Обмен буферами за O(1). Аллокаторы обмениваются, только если этого
+  // требует propagate_on_container_swap(иначе они должны быть равны)
+  void swap(ring_buffer &other) noexcept {
+    swapBuffers(other);
+    PropagateOnSwap(allocator(), other.allocator());
+  }
+
+ private:
+  using storage::allocator;
+
+  static constexpr size_type kMinCapacity = 16;
+
+  static size_type roundCapacity(size_type count) {
+    if (count > (std::numeric_limits<size_type>::max() >> 1) + 1)
+      throw std::length_error("ring_buffer::capacity is too big");
+    size_type capacity = kMinCapacity;
+    while (capacity < count) capacity <<= 1;
+    return capacity;
+  }
+
+  template <typename... Args>
+  void constructAt(pointer ptr, Args &&...args) {
+    alloc_traits::construct(allocator(), ptr, std::forward<Args>(args)...);
+  }
+
+  void destroyAt(pointer ptr) noexcept {
+    alloc_traits::destroy(allocator(), ptr);
+  }
+
+  // Переносит элементы в начало буфера buffer, старый буфер освобождается.
+  // Если перенос бросает(только при копировании типов, перемещение
+  // которых не noexcept), уже перенесенные копии разрушаются
+  void relocateTo(pointer buffer) {
+    if constexpr (is_trivially_relocatable<value_type>::value) {
+      // не более двух непрерывных отрезков: [head_, capacity_) и [0, ...)
+      size_type first = std::min(size_, capacity_ - head_);
+      if (first != 0) {
+        std::memcpy(static_cast<void *>(buffer),
+                    static_cast<const void *>(buffer_ + head_),
+                    first * sizeof(value_type));
+      }
+      if (size_ != first) {
+        std::memcpy(static_cast<void *>(buffer + first),
+                    static_cast<const void *>(buffer_),
+                    (size_ - first) * sizeof(value_type));
+      }
+    } else {
+      size_type i = 0;
+      try {
+        for (; i < size_; ++i)
+          constructAt(buffer + i, std::move_if_noexcept((*this)[i]));
+      } catch (...) {
+        while (i != 0) destroyAt(buffer + --i);
+        throw;
+      }
+      for (i = 0; i < size_; ++i) destroyAt(&(*this)[i]);
+    }
+    if (buffer_ != nullptr)
+      alloc_traits::deallocate(allocator(), buffer_, capacity_);
+    buffer_ = buffer;
+    head_ = 0;
+  }
+
+  void reallocate(size_type capacity) {
+    pointer buffer = alloc_traits::allocate(allocator(), capacity);
+    try {
+      relocateTo(buffer);
+    } catch (...) {
+      alloc_traits::deallocate(allocator(), buffer, capacity);
+      throw;
+    }
+    capacity_ = capacity;
+  }
+
+  // Рост заполненного буфера вдвое с созданием нового элемента из args в
+  // ячейке position нового буфера. Старые элементы переезжают в [0, size_)
+  template <typename... Args>
+  void growWith(size_type position, Args &&...args) {
+    if (size_ == max_size()) throw std::length_error("ring_buffer::full");
+    size_type capacity = capacity_ == 0 ? kMinCapacity : capacity_ * 2;
+    pointer buffer = alloc_traits::allocate(allocator(), capacity);
+    try {
+      constructAt(buffer + position, std::forward<Args>(args)...);
+    } catch (...) {
+      alloc_traits::deallocate(allocator(), buffer, capacity);
+      throw;
+    }
+    try {
+      relocateTo(buffer);
+    } catch (...) {
+      destroyAt(buffer + position);
+      alloc_traits::deallocate(allocator(), buffer, capacity);
+      throw;
+    }
+    capacity_ = capacity;
+  }
+
+  void release() noexcept {
+    clear();
+    if (buffer_ != nullptr)
+      alloc_traits::deallocate(allocator(), buffer_, capacity_);
+    buffer_ = nullptr;
+    capacity_ = 0;
+  }
+
+  // Обмен содержимым без аллокаторов
+  void swapBuffers(ring_buffer &other) noexcept {
+    std::swap(buffer_, other.buffer_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+  }
+
+  // Перемещающее присваивание, когда буфер other можно забрать целиком
+  void stealBuffer(ring_buffer &other) noexcept {
+    release();
+    swapBuffers(other);
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                      value) {
+      allocator() = std::move(other.allocator());
+    }
+  }
+
+  // Элементы other перемещаются в конец *this, память other освобождается
+  void moveElementsFrom(ring_buffer &other) {
+    reserve(size_ + other.size_);
+    for (size_type i = 0; i < other.size_; ++i)
+      emplace_back(std::move(other[i]));
+    other.release();
+  }
+
+  pointer buffer_ = nullptr;
+  size_type capacity_ = 0;
+  // Индекс первого элемента
+  size_type head_ = 0;
+  size_type size_ = 0;
+};
+
+namespace pmr {
+// ring_buffer, память которого берется из std::pmr::memory_resource
+template <typename T>
+using ring_buffer = s21::ring_buffer<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_RING_BUFFER_H_
@@ -1,12 +1,18 @@
 #ifndef S21_CONTAINERS_S21_SET_H_
 #define S21_CONTAINERS_S21_SET_H_
 
+#include <memory_resource>
 #include <vector>
 
 #include "s21_tree.h"
 
 namespace s21 {
-template <class Key>
+// Compare - порядок элементов, Statistic - политика дерева(OrderStatistic
+// добавляет find_by_order и order_of_key), Allocator - откуда берется
+// память дерева(см. RBTree)
+template <class Key, class Compare = std::less<Key>,
+          class Statistic = NoOrderStatistic,
+          class Allocator = std::allocator<Key>>
 class set {
  public:
   // Тим элемента-ключ
@@ -19,112 +25,294 @@ class set {
   using const_reference = const value_type &;
   // Тип для размера контейнера
   using size_type = std::size_t;
+  // Аллокатор множества
+  using allocator_type = Allocator;
 
   // Внутренние классы
   //  1)дерева
-  using tree_type = RBTree<value_type>;
+  using tree_type =
+      RBTree<value_type, Compare, NodePool, Statistic, Allocator>;
   // 2)итератор
   using iterator = typename tree_type::iterator;
   // 3)константный итератор
   using const_iterator = typename tree_type::const_iterator;
+  // 4)извлеченный узел(node handle)
+  using node_type = typename tree_type::node_type;
+  // 5)результат вставки node handle
+  using insert_return_type = typename tree_type::insert_return_type;
 
   // конструктор по умолчанию, создает пустое множество
-  set() : tree_(new tree_type{}) {}
+  set() = default;
+
+  // пустое множество, память которого берется у alloc
+  explicit set(const allocator_type &alloc) : tree_(alloc) {}
 
   // конструктор создания множества(инициализация с помощью
   //  std::initializer_list)
-  set(std::initializer_list<value_type> const &items) : set() {
-    for (auto item : items) {
-      insert(item);
-    }
+  set(std::initializer_list<value_type> const &items,
+      const allocator_type &alloc = allocator_type())
+      : set(items.begin(), items.end(), alloc) {}
+
+  // конструктор из диапазона [first, last). Уже отсортированный диапазон
+  // превращается в дерево за линейное время
+  template <typename InputIt>
+  set(InputIt first, InputIt last,
+      const allocator_type &alloc = allocator_type())
+      : set(alloc) {
+    tree_.AssignRange(first, last, true);
   }
 
   // конструктор копирования
-  set(const set &s) : tree_(new tree_type(*s.tree_)) {}
+  set(const set &s) : tree_(s.tree_) {}
+
+  // копия s в памяти alloc
+  set(const set &s, const allocator_type &alloc) : tree_(s.tree_, alloc) {}
 
   // оператор присваивания копированием
   set &operator=(const set &s) {
-    *tree_ = *s.tree_;
+    tree_ = s.tree_;
     return *this;
   }
 
   // конструктор переноса
-  set(set &&s) noexcept : tree_(new tree_type(std::move(*s.tree_))) {}
+  set(set &&s) noexcept : tree_(std::move(s.tree_)) {}
+
+  // перенос s в память alloc(элементы перемещаются, если аллокаторы не
+  // равны)
+  set(set &&s, const allocator_type &alloc)
+      : tree_(std::move(s.tree_), alloc) {}
 
   // оператор присваивания переносом
-  set &operator=(set &&s) noexcept {
-    *tree_ = std::move(*s.tree_);
+  set &operator=(set &&s) noexcept(kMoveStealsMemory<Allocator>) {
+    tree_ = std::move(s.tree_);
     return *this;
   }
 
-  // Деструктор
-  ~set() {
-    delete tree_;
-    // не забываем занулить
-    tree_ = nullptr;
+  // Аллокатор множества
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
   }
 
   // возвращает итератор в начало контейнера
-  iterator begin() noexcept { return tree_->begin_(); }
+  iterator begin() noexcept { return tree_.begin_(); }
 
   // тот же begin только для const
-  const_iterator begin() const noexcept { return tree_->begin_(); }
+  const_iterator begin() const noexcept { return tree_.begin_(); }
 
   // возвращает итератор на конец контейнера(после последнего элемента)
-  iterator end() noexcept { return tree_->end_(); }
+  iterator end() noexcept { return tree_.end_(); }
 
   // const версия для end()
-  const_iterator end() const noexcept { return tree_->end_(); }
+  const_iterator end() const noexcept { return tree_.end_(); }
 
   // Находит элемент с ключом эквивалентный ключу key
-  iterator find(const key_type &key) noexcept { return tree_->Find(key); }
+  iterator find(const key_type &key) noexcept { return tree_.Find(key); }
 
   // const версия для find()
   const_iterator find(const key_type &key) const noexcept {
-    return tree_->Find(key);
+    return tree_.Find(key);
+  }
+
+  // find() по любому ключу K, сравнимому с элементами(например
+  // std::string_view для множества строк). Только для прозрачного Compare
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  iterator find(const K &key) noexcept {
+    return tree_.Find(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator find(const K &key) const noexcept {
+    return tree_.Find(key);
   }
 
   // Возвращает кол-во элементов контейнера
-  size_type size() const noexcept { return tree_->_size_(); }
+  size_type size() const noexcept { return tree_._size_(); }
 
   // Возвращает true если контейнер пустой, false если нет
-  bool empty() const noexcept { return tree_->isEmpty(); }
+  bool empty() const noexcept { return tree_.isEmpty(); }
 
   // Возвращает максимально допустимое кол-во элементов в контейнере
-  size_type max_size() const noexcept { return tree_->maxSize(); }
+  size_type max_size() const noexcept { return tree_.maxSize(); }
 
   // очистка содержимого контейнера
-  void clear() noexcept { tree_->clear(); }
+  void clear() noexcept { tree_.clear(); }
 
   // удаляет элемент по передаваемой позиции ind
-  void erase(iterator pos) noexcept { tree_->Erase(pos); }
+  void erase(iterator pos) noexcept(!kCheckedIterators) {
+    tree_.Erase(pos);
+  }
 
   // Обменивает содержимое контейнера с other
-  void swap(set &other) noexcept { tree_->swap(*other.tree_); }
+  void swap(set &other) noexcept { tree_.swap(other.tree_); }
 
   // Вытаскиваем из other вставляем в контейнер. Если такой элемент есть-вставка
-  // не происходит
-  void merge(set &other) noexcept { tree_->UniqueMerge(*other.tree_); }
+  // не происходит. Пулы контейнеров не разделяются. Если в other не
+  // остается элементов из его пула, то его блоки переходят к нам и узлы
+  // перевешиваются без копирования: ссылки и указатели на перенесенные
+  // элементы остаются действительными. Иначе(и при разных аллокаторах)
+  // элементы переносятся в новые узлы, и возможно исключение. Оставшиеся в
+  // other элементы не трогаются
+  void merge(set &other) {
+    tree_.UniqueMerge(other.tree_);
+  }
 
   // Вставка элемента в контейнер, если такого ключа в контейнере нет
   std::pair<iterator, bool> insert(const value_type &value) {
-    return tree_->UniqueInsert(value);
+    return tree_.UniqueInsert(value);
+  }
+
+  // Вставка с подсказкой: hint - позиция, перед которой должен оказаться
+  // элемент. При верной подсказке(например end() для возрастающих ключей)
+  // спуска от корня не будет
+  iterator insert(const_iterator hint, const value_type &value) {
+    return tree_.InsertKey(hint, value, true).first;
+  }
+
+  // Создает элемент из args и вставляет его с подсказкой hint
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return tree_.EmplaceHint(hint, true, std::forward<Args>(args)...).first;
+  }
+
+  // Извлекает узел на позиции pos из контейнера. Node handle владеет узлом
+  // сам, поэтому элемент из пула один раз переносится в отдельный узел
+  node_type extract(const_iterator pos) {
+    return tree_.Extract(pos);
+  }
+
+  // Извлекает узел с ключом key(пустой node_type, если ключа нет)
+  node_type extract(const key_type &key) {
+    return tree_.ExtractKey(key);
+  }
+
+  // Вставляет извлеченный узел без выделения памяти. Если ключ уже есть, то
+  // узел возвращается обратно в поле node результата
+  insert_return_type insert(node_type &&nh) {
+    std::pair<iterator, bool> res = tree_.InsertNode(nh, true);
+    return insert_return_type{res.first, res.second, std::move(nh)};
+  }
+
+  // Операции над множествами. other поглощается целиком(после операции он
+  // пуст): его узлы переиспользуются или удаляются. При равных
+  // аллокаторах новых выделений нет. При разных элементы other сначала
+  // переносятся в новые узлы, и если это бросит исключение, оба
+  // контейнера не изменятся.
+
+  // this = this ∪ other
+  void set_union(set &other) { tree_.SetUnion(other.tree_, true); }
+
+  // this = this ∩ other
+  void set_intersection(set &other) {
+    tree_.SetIntersection(other.tree_, true);
+  }
+
+  // this = this \ other
+  void set_difference(set &other) {
+    tree_.SetDifference(other.tree_, true);
   }
 
   // Проверка на элемент с ключом key(true-да,false-нет)
   bool contains(const key_type &key) const noexcept {
-    return tree_->Find(key) != tree_->end_();
+    return tree_.Find(key) != tree_.end_();
   }
 
-  // Размещаем новые элементы в контейнер, если такого ключа еще нет
+  // Количество элементов с ключом key(0 или 1)
+  size_type count(const key_type &key) const noexcept {
+    return contains(key) ? 1 : 0;
+  }
+
+  // Итератор на первый элемент, не меньший key
+  iterator lower_bound(const key_type &key) noexcept {
+    return tree_.LowBow(key);
+  }
+
+  // const версия lower_bound()
+  const_iterator lower_bound(const key_type &key) const noexcept {
+    return tree_.LowBow(key);
+  }
+
+  // Итератор на первый элемент, больший key
+  iterator upper_bound(const key_type &key) noexcept {
+    return tree_.UppBow(key);
+  }
+
+  // const версия upper_bound()
+  const_iterator upper_bound(const key_type &key) const noexcept {
+    return tree_.UppBow(key);
+  }
+
+  // Версии для ключа K при прозрачном Compare
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  bool contains(const K &key) const noexcept {
+    return tree_.Find(key) != tree_.end_();
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  size_type count(const K &key) const noexcept {
+    return tree_.CountKey(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  iterator lower_bound(const K &key) noexcept {
+    return tree_.LowBow(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator lower_bound(const K &key) const noexcept {
+    return tree_.LowBow(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  iterator upper_bound(const K &key) noexcept {
+    return tree_.UppBow(key);
+  }
+
+  template <typename K, typename C = Compare, typename = transparent_t<C>>
+  const_iterator upper_bound(const K &key) const noexcept {
+    return tree_.UppBow(key);
+  }
+
+  // Возвращает итератор на k-й по порядку элемент(нумерация с нуля) или
+  // end(), если k >= size(). Только для политики OrderStatistic, O(log n)
+  iterator find_by_order(size_type k) noexcept {
+    return tree_.FindByOrder(k);
+  }
+
+  // const версия find_by_order()
+  const_iterator find_by_order(size_type k) const noexcept {
+    return static_cast<const tree_type &>(tree_).FindByOrder(k);
+  }
+
+  // Возвращает количество элементов меньших key(позицию key в порядке
+  // возрастания). Только для политики OrderStatistic, O(log n)
+  size_type order_of_key(const key_type &key) const noexcept {
+    return tree_.OrderOfKey(key);
+  }
+
+  // Создает элемент из аргументов конструктора args прямо в узле дерева и
+  // вставляет его, если такого ключа еще нет
   template <typename... Args>
-  std::vector<std::pair<iterator, bool>> emplace(Args &&...args) {
-    return tree_->UniqEmplace(std::forward<Args>(args)...);
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return tree_.Emplace(true, std::forward<Args>(args)...);
+  }
+
+  // Вставляет каждый из args как отдельный элемент, если такого ключа еще нет
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    return tree_.InsertMany(true, std::forward<Args>(args)...);
   }
 
  private:
-  tree_type *tree_;
+  tree_type tree_;
 };
+
+namespace pmr {
+// set, вся память которого берется из std::pmr::memory_resource
+template <class Key, class Compare = std::less<Key>,
+          class Statistic = NoOrderStatistic>
+using set =
+    s21::set<Key, Compare, Statistic, std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
 }  // namespace s21
 
 #endif  // S21_CONTAINERS_S21_SET_H_
\ No newline at end of file
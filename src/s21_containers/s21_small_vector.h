@@ -0,0 +1,495 @@
+#ifndef S21_CONTAINERS_S21_SMALL_VECTOR_H_
+#define S21_CONTAINERS_S21_SMALL_VECTOR_H_
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "iterators/s21_checked_iterator.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Вектор с буфером на N элементов внутри самого объекта: пока элементов не
+// больше N, память в куче не выделяется. При переполнении элементы
+// переезжают в кучу, shrink_to_fit возвращает их обратно. Интерфейс тот же,
+// что у s21::vector, но перемещение и swap переносят элементы, если они
+// лежат во внутреннем буфере
+template <typename T, std::size_t N>
+class small_vector {
+  static_assert(N > 0, "small_vector needs inline capacity");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+#ifdef S21_CHECKED_ITERATORS
+  using iterator = CheckedIterator<T, small_vector>;
+  using const_iterator = CheckedIterator<const T, small_vector>;
+#else
+  using iterator = T *;
+  using const_iterator = const T *;
+#endif
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+ public:
+  small_vector() noexcept {}
+
+  explicit small_vector(size_type size) {
+    reserve(size);
+    try {
+      std::uninitialized_value_construct_n(buffer_, size);
+    } catch (...) {
+      deallocate(buffer_);
+      throw;
+    }
+    size_ = size;
+  }
+
+  small_vector(std::initializer_list<value_type> const &init) {
+    reserve(init.size());
+    try {
+      std::uninitialized_copy(init.begin(), init.end(), buffer_);
+    } catch (...) {
+      deallocate(buffer_);
+      throw;
+    }
+    size_ = init.size();
+  }
+
+  small_vector(const small_vector &cpy) {
+    reserve(cpy.size_);
+    try {
+      std::uninitialized_copy(cpy.buffer_, cpy.buffer_ + cpy.size_, buffer_);
+    } catch (...) {
+      deallocate(buffer_);
+      throw;
+    }
+    size_ = cpy.size_;
+  }
+
+  small_vector(small_vector &&mcv) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    stealFrom(mcv);
+  }
+
+  ~small_vector() {
+    std::destroy(buffer_, buffer_ + size_);
+    deallocate(buffer_);
+  }
+
+  small_vector &operator=(small_vector &&mcv) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (this != &mcv) {
+      clear();
+      deallocate(buffer_);
+      buffer_ = inlineData();
+      capacity_ = N;
+      stealFrom(mcv);
+      invalidateIterators();
+    }
+    return *this;
+  }
+
+  small_vector &operator=(const small_vector &mcv) {
+    if (this != &mcv) {
+      small_vector tmp(mcv);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+ public:
+  reference at(size_type ind) {
+    if (ind >= size_) {
+      throw std::logic_error("small_vector::The index is out of range");
+    }
+    return buffer_[ind];
+  }
+
+  const_reference at(size_type ind) const {
+    if (ind >= size_) {
+      throw std::logic_error("small_vector::The index is out of range");
+    }
+    return buffer_[ind];
+  }
+
+  // Без проверки границ(кроме режима S21_CHECKED_ITERATORS)
+  reference operator[](size_type ind) {
+    S21_ITERATOR_CHECK(ind < size_,
+                       "small_vector::The index is out of range");
+    return buffer_[ind];
+  }
+
+  const_reference operator[](size_type ind) const {
+    S21_ITERATOR_CHECK(ind < size_,
+                       "small_vector::The index is out of range");
+    return buffer_[ind];
+  }
+
+  iterator begin() noexcept { return makeIterator(buffer_); }
+
+  const_iterator begin() const noexcept { return makeIterator(buffer_); }
+
+  reference front() {
+    if (size_ == 0) throw std::logic_error("zero sized container used");
+    return buffer_[0];
+  }
+
+  const_reference front() const {
+    if (size_ == 0) throw std::logic_error("zero sized container used");
+    return buffer_[0];
+  }
+
+  iterator end() noexcept { return makeIterator(buffer_ + size_); }
+
+  const_iterator end() const noexcept { return makeIterator(buffer_ + size_); }
+
+  reference back() {
+    if (size_ == 0) throw std::logic_error("Methods on a zero");
+    return buffer_[size_ - 1];
+  }
+
+  const_reference back() const {
+    if (size_ == 0) throw std::logic_error("Methods on a zero");
+    return buffer_[size_ - 1];
+  }
+
+  pointer data() noexcept { return buffer_; }
+
+  const_pointer data() const noexcept { return buffer_; }
+
+ public:
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+
+  [[nodiscard]] size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(size_type) / 2;
+  }
+
+  void reserve(size_type capacity) {
+    if (capacity <= capacity_) {
+      return;
+    }
+    if (capacity > max_size()) {
+      throw std::logic_error(
+          "reserve capacity is more then max_size value_type");
+    }
+    reallocVector(capacity);
+  }
+
+  // Во внутреннем буфере емкость и так точная, поэтому как reserve
+  void reserve_exact(size_type capacity) { reserve(capacity); }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  // Если элементы помещаются во внутренний буфер - возвращаемся в него
+  void shrink_to_fit() {
+    if (capacity_ == size_ || isInline()) {
+      return;
+    }
+    reallocVector(std::max(size_, N));
+  }
+
+  // Элементы во внутреннем буфере лежат в самом объекте, поэтому их нельзя
+  // обменять указателями - тогда обмен идет через перемещение
+  void swap(small_vector &other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (!isInline() && !other.isInline()) {
+      std::swap(buffer_, other.buffer_);
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+      invalidateIterators();
+      other.invalidateIterators();
+    } else {
+      small_vector tmp(std::move(other));
+      other = std::move(*this);
+      *this = std::move(tmp);
+    }
+  }
+
+  iterator insert(const_iterator ind, value_type &&val) {
+    return emplaceAt(checkedPosition(ind), std::move(val));
+  }
+
+  iterator insert(const_iterator ind, const_reference val) {
+    return emplaceAt(checkedPosition(ind), val);
+  }
+
+  iterator erase(const_iterator ind) {
+    size_type position = checkedPosition(ind);
+
+    if (position >= size_) {
+      throw std::out_of_range("Position is out of range of begin to end");
+    }
+
+    std::move(buffer_ + position + 1, buffer_ + size_, buffer_ + position);
+    std::destroy_at(buffer_ + size_ - 1);
+    --size_;
+    invalidateIterators();
+    return begin() + position;
+  }
+
+  void push_back(const_reference val) { emplaceBack(val); }
+
+  void push_back(value_type &&val) { emplaceBack(std::move(val)); }
+
+  void pop_back() {
+    if (size_ == 0) {
+      throw std::logic_error("Vector is null, size = 0");
+    }
+    std::destroy_at(buffer_ + size_ - 1);
+    --size_;
+  }
+
+  // Элемент создается прямо в буфере из аргументов конструктора args
+  template <typename... Args>
+  iterator emplace(const_iterator ind, Args &&...args) {
+    return emplaceAt(checkedPosition(ind), std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    return *emplaceBack(std::forward<Args>(args)...);
+  }
+
+  // Каждый из args вставляется отдельным элементом начиная с ind,
+  // возвращается итератор на последний вставленный(или ind, если args пуст)
+  template <typename... Args>
+  iterator insert_many(const_iterator ind, Args &&...args) {
+    size_type position = checkedPosition(ind);
+    (emplaceAt(position++, std::forward<Args>(args)), ...);
+    return begin() + position - (sizeof...(args) == 0 ? 0 : 1);
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (emplaceBack(std::forward<Args>(args)), ...);
+  }
+
+  void clear() noexcept {
+    std::destroy(buffer_, buffer_ + size_);
+    size_ = 0;
+  }
+
+  // Лежат ли элементы во внутреннем буфере(без памяти в куче)
+  bool is_inline() const noexcept { return isInline(); }
+
+ private:
+  size_type size_ = 0;
+  size_type capacity_ = N;
+  pointer buffer_ = inlineData();
+  alignas(value_type) unsigned char storage_[N * sizeof(value_type)];
+#ifdef S21_CHECKED_ITERATORS
+  // Растет, когда итераторы становятся недействительными
+  size_type version_ = 0;
+
+  friend iterator;
+  friend const_iterator;
+#endif
+
+  static constexpr bool kOverAligned =
+      alignof(value_type) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+  pointer inlineData() noexcept {
+    return reinterpret_cast<pointer>(storage_);
+  }
+
+  const_pointer inlineData() const noexcept {
+    return reinterpret_cast<const_pointer>(storage_);
+  }
+
+  bool isInline() const noexcept { return buffer_ == inlineData(); }
+
+  // Сырая память в куче под count элементов, ничего не конструируется
+  static pointer allocate(size_type count) {
+    if (count > std::numeric_limits<size_type>::max() / sizeof(value_type))
+      throw std::length_error("small_vector::allocation size is too big");
+    if constexpr (kOverAligned) {
+      return static_cast<pointer>(::operator new(
+          count * sizeof(value_type), std::align_val_t(alignof(value_type))));
+    } else {
+      return static_cast<pointer>(::operator new(count * sizeof(value_type)));
+    }
+  }
+
+  // Внутренний буфер не освобождается
+  void deallocate(pointer buffer) const noexcept {
+    if (buffer == inlineData()) return;
+    if constexpr (kOverAligned) {
+      ::operator delete(buffer, std::align_val_t(alignof(value_type)));
+    } else {
+      ::operator delete(buffer);
+    }
+  }
+
+  // Память под capacity элементов: внутренний буфер, если помещаются
+  pointer allocateFor(size_type capacity) {
+    return capacity <= N ? inlineData() : allocate(capacity);
+  }
+
+  // Забирает элементы mcv в пустой *this с внутренним буфером: память кучи
+  // передается указателем, элементы внутреннего буфера переносятся
+  void stealFrom(small_vector &mcv) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (mcv.isInline()) {
+      mcv.relocate(buffer_, mcv.size_, 0);
+    } else {
+      buffer_ = std::exchange(mcv.buffer_, mcv.inlineData());
+      capacity_ = std::exchange(mcv.capacity_, N);
+    }
+    size_ = std::exchange(mcv.size_, 0);
+    mcv.invalidateIterators();
+  }
+
+  size_type IteratorVersion() const noexcept {
+#ifdef S21_CHECKED_ITERATORS
+    return version_;
+#else
+    return 0;
+#endif
+  }
+
+  void invalidateIterators() noexcept {
+#ifdef S21_CHECKED_ITERATORS
+    ++version_;
+#endif
+  }
+
+  iterator makeIterator(pointer ptr) noexcept {
+#ifdef S21_CHECKED_ITERATORS
+    return iterator(ptr, this);
+#else
+    return ptr;
+#endif
+  }
+
+  const_iterator makeIterator(const_pointer ptr) const noexcept {
+#ifdef S21_CHECKED_ITERATORS
+    return const_iterator(ptr, this);
+#else
+    return ptr;
+#endif
+  }
+
+  size_type checkedPosition(const_iterator ind) const {
+    size_type position = ind - begin();
+    if (position > size_) {
+      throw std::out_of_range("Position is out of range of begin to end");
+    }
+    return position;
+  }
+
+  size_type nextCapacity() const noexcept { return 2 * capacity_; }
+
+  // Переносит элементы в new_buffer, оставляя gap пустых ячеек на месте
+  // position(как у s21::vector). При исключении *this не меняется
+  void relocate(pointer new_buffer, size_type position, size_type gap) {
+    if constexpr (is_trivially_relocatable<value_type>::value) {
+      if (size_ == 0) return;
+      std::memcpy(static_cast<void *>(new_buffer),
+                  static_cast<const void *>(buffer_),
+                  position * sizeof(value_type));
+      std::memcpy(static_cast<void *>(new_buffer + position + gap),
+                  static_cast<const void *>(buffer_ + position),
+                  (size_ - position) * sizeof(value_type));
+    } else {
+      size_type done = 0;
+      try {
+        for (; done < position; ++done)
+          ::new (static_cast<void *>(new_buffer + done))
+              value_type(std::move_if_noexcept(buffer_[done]));
+        for (; done < size_; ++done)
+          ::new (static_cast<void *>(new_buffer + done + gap))
+              value_type(std::move_if_noexcept(buffer_[done]));
+      } catch (...) {
+        std::destroy(new_buffer, new_buffer + std::min(done, position));
+        if (done > position)
+          std::destroy(new_buffer + position + gap, new_buffer + done + gap);
+        throw;
+      }
+      std::destroy(buffer_, buffer_ + size_);
+    }
+  }
+
+  void reallocVector(size_type capacity) {
+    pointer temp = allocateFor(capacity);
+    if (temp == buffer_) return;
+    try {
+      relocate(temp, size_, 0);
+    } catch (...) {
+      deallocate(temp);
+      throw;
+    }
+    deallocate(buffer_);
+    buffer_ = temp;
+    capacity_ = std::max(capacity, N);
+    invalidateIterators();
+  }
+
+  // Создает элемент из args на месте position, сдвигая хвост. args могут
+  // ссылаться на элементы самого вектора
+  template <typename... Args>
+  iterator emplaceAt(size_type position, Args &&...args) {
+    if (size_ == capacity_)
+      return growAndEmplace(position, std::forward<Args>(args)...);
+    if (position == size_) return emplaceBack(std::forward<Args>(args)...);
+    value_type tmp(std::forward<Args>(args)...);
+    pointer last = buffer_ + size_;
+    ::new (static_cast<void *>(last)) value_type(std::move(*(last - 1)));
+    std::move_backward(buffer_ + position, last - 1, last);
+    buffer_[position] = std::move(tmp);
+    ++size_;
+    invalidateIterators();
+    return begin() + position;
+  }
+
+  // Вставка в конец не требует присваивания от value_type
+  template <typename... Args>
+  iterator emplaceBack(Args &&...args) {
+    if (size_ == capacity_)
+      return growAndEmplace(size_, std::forward<Args>(args)...);
+    ::new (static_cast<void *>(buffer_ + size_))
+        value_type(std::forward<Args>(args)...);
+    ++size_;
+    return end() - 1;
+  }
+
+  // Рост происходит только из заполненного буфера, поэтому новая память
+  // всегда в куче. Новый элемент создается в ней до переноса старых
+  template <typename... Args>
+  iterator growAndEmplace(size_type position, Args &&...args) {
+    size_type capacity = nextCapacity();
+    pointer temp = allocate(capacity);
+    try {
+      ::new (static_cast<void *>(temp + position))
+          value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      deallocate(temp);
+      throw;
+    }
+    try {
+      relocate(temp, position, 1);
+    } catch (...) {
+      std::destroy_at(temp + position);
+      deallocate(temp);
+      throw;
+    }
+    deallocate(buffer_);
+    buffer_ = temp;
+    capacity_ = capacity;
+    ++size_;
+    invalidateIterators();
+    return begin() + position;
+  }
+};
+}  // namespace s21
+#endif  // S21_CONTAINERS_S21_SMALL_VECTOR_H_
@@ -0,0 +1,178 @@
+#ifndef S21_CONTAINERS_S21_SPSC_QUEUE_H_
+#define S21_CONTAINERS_S21_SPSC_QUEUE_H_
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_cache_line.h"
+
+namespace s21 {
+// Ограниченная очередь без блокировок для ровно одного потока-писателя и
+// одного потока-читателя. Элементы лежат в кольце на Capacity ячеек внутри
+// самого объекта, индексы head_(читатель) и tail_(писатель) только растут,
+// ячейка - индекс по маске. Каждый индекс пишет только один поток, поэтому
+// нужны лишь load/store с acquire/release, без атомарных RMW.
+// Индексы и их кэшированные копии разнесены по разным линиям кэша.
+//
+// push, emplace и push_n вызывает только писатель, front, pop и pop_n -
+// только читатель. Заполненная очередь не растет: push возвращает false.
+// size() и empty() из третьего потока дают лишь моментальный снимок
+template <typename T, std::size_t Capacity>
+class spsc_queue {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                "spsc_queue::Capacity must be a power of two");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  spsc_queue() noexcept {}
+
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+
+  ~spsc_queue() {
+    while (pop()) {
+    }
+  }
+
+  static constexpr size_type capacity() noexcept { return Capacity; }
+
+  size_type size() const noexcept {
+    size_type head = head_.load(std::memory_order_acquire);
+    size_type tail = tail_.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  // Писатель. false, если очередь заполнена(value не тронут)
+  bool push(const_reference value) { return emplace(value); }
+
+  bool push(value_type &&value) { return emplace(std::move(value)); }
+
+  template <typename... Args>
+  bool emplace(Args &&...args) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    if (freeSlots(tail, 1) == 0) return false;
+    ::new (static_cast<void *>(slot(tail))) T(std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Писатель. Кладет до count элементов из first одной публикацией,
+  // возвращает, сколько поместилось
+  template <typename InputIt>
+  size_type push_n(InputIt first, size_type count) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    size_type n = std::min(count, freeSlots(tail, count));
+    size_type done = 0;
+    try {
+      for (; done < n; ++done, ++first)
+        ::new (static_cast<void *>(slot(tail + done))) T(*first);
+    } catch (...) {
+      // созданные до исключения элементы все равно публикуются
+      tail_.store(tail + done, std::memory_order_release);
+      throw;
+    }
+    tail_.store(tail + n, std::memory_order_release);
+    return n;
+  }
+
+  // Читатель. Первый элемент, очередь не должна быть пустой
+  reference front() {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (readySlots(head, 1) == 0)
+      throw std::logic_error("spsc_queue::queue is empty");
+    return *slot(head);
+  }
+
+  // Читатель. Удаляет первый элемент, false - если очередь пуста
+  bool pop() noexcept {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (readySlots(head, 1) == 0) return false;
+    slot(head)->~T();
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Читатель. Переносит первый элемент в value и удаляет его
+  bool pop(value_type &value) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (readySlots(head, 1) == 0) return false;
+    value = std::move(*slot(head));
+    slot(head)->~T();
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Читатель. Переносит в out до count элементов и освобождает их ячейки
+  // одной публикацией, возвращает, сколько перенесено
+  template <typename OutputIt>
+  size_type pop_n(OutputIt out, size_type count) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    size_type n = std::min(count, readySlots(head, count));
+    size_type done = 0;
+    try {
+      for (; done < n; ++done, ++out) {
+        *out = std::move(*slot(head + done));
+        slot(head + done)->~T();
+      }
+    } catch (...) {
+      // элемент, на котором случилось исключение, остается в очереди
+      head_.store(head + done, std::memory_order_release);
+      throw;
+    }
+    head_.store(head + n, std::memory_order_release);
+    return n;
+  }
+
+ private:
+  static constexpr size_type kMask = Capacity - 1;
+
+  T *slot(size_type index) noexcept {
+    return std::launder(reinterpret_cast<T *>(slots_[index & kMask].data_));
+  }
+
+  // Свободные ячейки для писателя. Индекс читателя перечитывается, только
+  // если по старой копии места не хватает
+  size_type freeSlots(size_type tail, size_type wanted) noexcept {
+    size_type free = Capacity - (tail - head_cache_);
+    if (free < wanted) {
+      head_cache_ = head_.load(std::memory_order_acquire);
+      free = Capacity - (tail - head_cache_);
+    }
+    return free;
+  }
+
+  // Готовые элементы для читателя, аналогично freeSlots
+  size_type readySlots(size_type head, size_type wanted) noexcept {
+    size_type ready = tail_cache_ - head;
+    if (ready < wanted) {
+      tail_cache_ = tail_.load(std::memory_order_acquire);
+      ready = tail_cache_ - head;
+    }
+    return ready;
+  }
+
+  struct Slot {
+    alignas(T) unsigned char data_[sizeof(T)];
+  };
+
+  // Линия читателя: его индекс и последний увиденный индекс писателя
+  alignas(kCacheLineSize) std::atomic<size_type> head_{0};
+  size_type tail_cache_ = 0;
+  // Линия писателя
+  alignas(kCacheLineSize) std::atomic<size_type> tail_{0};
+  size_type head_cache_ = 0;
+  alignas(kCacheLineSize) Slot slots_[Capacity];
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_SPSC_QUEUE_H_
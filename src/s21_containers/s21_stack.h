@@ -2,101 +2,171 @@
 #define S21_CONTAINERS_S21_STACK_H
 
 #include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
 
 #include "s21_list.h"
+#include "s21_ring_buffer.h"
 
 namespace s21 {
-template <typename T>
+// Адаптер стека над Container, как у стандартных адаптеров. По умолчанию
+// элементы лежат в кольцевом буфере s21::ring_buffer; подойдут и
+// s21::list, и s21::vector(нужны back, push_back, emplace_back, pop_back,
+// insert_many_back, swap и get_allocator)
+template <typename T, typename Container = ring_buffer<T>>
 class stack {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
   using size_type = size_t;
+  using allocator_type = typename Container::allocator_type;
 
   stack() = default;
-  stack(std::initializer_list<T> const& items);
+  explicit stack(const allocator_type& alloc);
+  explicit stack(const container_type& container);
+  explicit stack(container_type&& container);
+  stack(std::initializer_list<T> const& items,
+        const allocator_type& alloc = allocator_type());
   stack(const stack& other);
-  stack(stack&& other) noexcept;
+  stack(const stack& other, const allocator_type& alloc);
+  stack(stack&& other) noexcept(
+      std::is_nothrow_move_constructible_v<Container>);
+  stack(stack&& other, const allocator_type& alloc);
   stack& operator=(const stack& other);
-  stack& operator=(stack&& other) noexcept;
+  stack& operator=(stack&& other) noexcept(
+      std::is_nothrow_move_assignable_v<Container>);
   ~stack();
 
   const_reference top();
   bool empty() const;
   size_type size() const;
   void push(const_reference value);
+  void push(value_type&& value);
   template <class... Args>
   void emplace(Args&&... args);
+  template <class... Args>
+  void insert_many_front(Args&&... args);
   void pop();
   void swap(stack& other);
+  allocator_type get_allocator() const;
 
  private:
-  list<value_type> list_;
+  container_type container_;
 };
 
-template <typename T>
-stack<T>::stack(const stack& other) : list_{other.list_} {}
+template <typename T, typename Container>
+stack<T, Container>::stack(const allocator_type& alloc) : container_(alloc) {}
 
-template <typename T>
-stack<T>::stack(std::initializer_list<T> const& items) : list_{items} {}
+template <typename T, typename Container>
+stack<T, Container>::stack(const container_type& container)
+    : container_(container) {}
 
-template <typename T>
-stack<T>::stack(stack&& other) noexcept : list_{std::move(other.list_)} {}
+template <typename T, typename Container>
+stack<T, Container>::stack(container_type&& container)
+    : container_(std::move(container)) {}
 
-template <typename T>
-stack<T>& stack<T>::operator=(const stack& other) {
+template <typename T, typename Container>
+stack<T, Container>::stack(const stack& other)
+    : container_{other.container_} {}
+
+template <typename T, typename Container>
+stack<T, Container>::stack(const stack& other, const allocator_type& alloc)
+    : container_(other.container_, alloc) {}
+
+template <typename T, typename Container>
+stack<T, Container>::stack(std::initializer_list<T> const& items,
+                           const allocator_type& alloc)
+    : container_(items, alloc) {}
+
+template <typename T, typename Container>
+stack<T, Container>::stack(stack&& other) noexcept(
+    std::is_nothrow_move_constructible_v<Container>)
+    : container_{std::move(other.container_)} {}
+
+template <typename T, typename Container>
+stack<T, Container>::stack(stack&& other, const allocator_type& alloc)
+    : container_(std::move(other.container_), alloc) {}
+
+template <typename T, typename Container>
+stack<T, Container>& stack<T, Container>::operator=(const stack& other) {
   if (this != &other) {
     stack(other).swap(*this);
   }
   return *this;
 }
 
-template <typename T>
-stack<T>& stack<T>::operator=(stack&& other) noexcept {
+template <typename T, typename Container>
+stack<T, Container>& stack<T, Container>::operator=(stack&& other) noexcept(
+    std::is_nothrow_move_assignable_v<Container>) {
   if (this != &other) {
-    list_ = std::move(other.list_);
+    container_ = std::move(other.container_);
   }
   return *this;
 }
 
-template <typename T>
-stack<T>::~stack() {}
+template <typename T, typename Container>
+stack<T, Container>::~stack() {}
 
-template <typename T>
-typename stack<T>::const_reference stack<T>::top() {
-  return list_.back();
+template <typename T, typename Container>
+typename stack<T, Container>::const_reference stack<T, Container>::top() {
+  return container_.back();
 }
 
-template <typename T>
-bool stack<T>::empty() const {
-  return list_.empty();
+template <typename T, typename Container>
+bool stack<T, Container>::empty() const {
+  return container_.empty();
 }
 
-template <typename T>
-typename stack<T>::size_type stack<T>::size() const {
-  return list_.size();
+template <typename T, typename Container>
+typename stack<T, Container>::size_type stack<T, Container>::size() const {
+  return container_.size();
 }
 
-template <typename T>
-void stack<T>::push(const_reference value) {
-  list_.push_back(value);
+template <typename T, typename Container>
+void stack<T, Container>::push(const_reference value) {
+  container_.push_back(value);
 }
 
-template <typename T>
+template <typename T, typename Container>
+void stack<T, Container>::push(value_type&& value) {
+  container_.push_back(std::move(value));
+}
+
+template <typename T, typename Container>
 template <class... Args>
-void stack<T>::emplace(Args&&... args) {
-  list_.emplace_front(std::forward<Args>(args)...);
+void stack<T, Container>::emplace(Args&&... args) {
+  container_.emplace_back(std::forward<Args>(args)...);
 }
 
-template <typename T>
-void stack<T>::pop() {
-  list_.pop_back();
+template <typename T, typename Container>
+template <class... Args>
+void stack<T, Container>::insert_many_front(Args&&... args) {
+  container_.insert_many_back(std::forward<Args>(args)...);
 }
 
-template <typename T>
-void stack<T>::swap(stack& other) {
-  list_.swap(other.list_);
+template <typename T, typename Container>
+void stack<T, Container>::pop() {
+  container_.pop_back();
+}
+
+template <typename T, typename Container>
+void stack<T, Container>::swap(stack& other) {
+  container_.swap(other.container_);
 }
+
+template <typename T, typename Container>
+typename stack<T, Container>::allocator_type
+stack<T, Container>::get_allocator() const {
+  return container_.get_allocator();
+}
+
+namespace pmr {
+// stack, элементы которого берутся из std::pmr::memory_resource
+template <typename T>
+using stack = s21::stack<T, pmr::ring_buffer<T>>;
+}  // namespace pmr
 }  // namespace s21
 #endif  // S21_CONTAINERS_S21_STACK_H
@@ -1,21 +1,72 @@
 #ifndef S21_CONTAINERS_SRC_S21_CONTAINERS_S21_TREE_H
 #define S21_CONTAINERS_SRC_S21_CONTAINERS_S21_TREE_H
 
+#include <algorithm>
 #include <functional>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "iterators/s21_checked_iterator.h"
+#include "s21_allocator.h"
+#include "s21_node_pool.h"
+
 namespace s21 {
 
 // цвета нашего дерева
 enum RBTreeColor { tBlack, tRed };
 
-template <typename Key, typename Comparator = std::less<Key>>
+// Политики дополнительной информации в узлах дерева. Узел наследуется от
+// NodeBase выбранной политики, поэтому пустая база ничего не стоит
+
+// Без дополнительной информации(по умолчанию)
+struct NoOrderStatistic {
+  static constexpr bool kEnabled = false;
+
+  struct NodeBase {
+    void ResetStatistic() noexcept {}
+  };
+};
+
+// Статистика порядка: каждый узел хранит размер своего поддерева, что дает
+// поиск k-го элемента и ранга ключа за O(log n)
+struct OrderStatistic {
+  static constexpr bool kEnabled = true;
+
+  struct NodeBase {
+    void ResetStatistic() noexcept { count_ = 1; }
+
+    std::size_t count_ = 1;
+  };
+};
+
+// Поиск ключом другого типа(без создания элемента) разрешен только для
+// прозрачных компараторов(Compare::is_transparent, например std::less<>)
+template <typename Compare>
+using transparent_t = typename Compare::is_transparent;
+
+// NodeAllocator - как раздается память под узлы. По умолчанию это пул,
+// принадлежащий дереву(см. s21_node_pool.h), NodeHeapAllocator выделяет
+// каждый узел отдельно. Statistic - политика дополнительной информации в
+// узлах(NoOrderStatistic или OrderStatistic). Allocator - откуда берется
+// вся память дерева: блоки пула, служебный узел и сам пул. Ключи создаются
+// через std::allocator_traits этого аллокатора
+template <typename Key, typename Comparator = std::less<Key>,
+          template <typename, typename> class NodeAllocator = NodePool,
+          typename Statistic = NoOrderStatistic,
+          typename Allocator = std::allocator<Key>>
 class RBTree {
  private:
   struct RedBlackNode;
   struct RedBlackIterator;
   struct RedBlackIteratorConst;
+  class RedBlackNodeHandle;
+  struct RedBlackInsertReturn;
 
  public:
   // Тип элемента
@@ -27,7 +78,7 @@ class RBTree {
   // Внутренний класс для обычных итераторов(не константых)
   using iterator = RedBlackIterator;
   // Внутренний класс для константных итераторов
-  using const_iterator = const RedBlackIteratorConst;
+  using const_iterator = RedBlackIteratorConst;
   // Тип размера контейнера
   using size_type = std::size_t;
 
@@ -37,22 +88,66 @@ class RBTree {
   using tree_node = RedBlackNode;
   // Внутренний класс цвета дерева
   using tree_color = RBTreeColor;
+  // Аллокатор дерева
+  using allocator_type = Allocator;
+  // Аллокатор узлов дерева
+  using node_allocator = NodeAllocator<tree_node, Allocator>;
+  // Включена ли статистика порядка
+  using statistic_tag = std::integral_constant<bool, Statistic::kEnabled>;
+  // Узел, извлеченный из дерева(node handle)
+  using node_type = RedBlackNodeHandle;
+  // Результат вставки node handle в уникальное дерево
+  using insert_return_type = RedBlackInsertReturn;
 
   // создание пустого дерева, конструктор по умолчанию
-  RBTree() : head_(new tree_node), size_(0U) {}
+  RBTree() : RBTree(allocator_type()) {}
+
+  // пустое дерево, вся память которого берется у alloc
+  explicit RBTree(const allocator_type &alloc)
+      : head_(nullptr),
+        size_(0U),
+        alloc_(alloc) {
+    head_ = CreateHead();
+  }
+
+  // конструктор копирования(аллокатор от select_on_container_copy_construction)
+  RBTree(const tree_type &other)
+      : RBTree(other, alloc_traits::select_on_container_copy_construction(
+                          other.get_allocator())) {}
 
-  // конструктор переноса
-  RBTree(const tree_type &other) : RBTree() {
-    if (other.size_() > 0) {
+  // копия other в памяти alloc
+  RBTree(const tree_type &other, const allocator_type &alloc) : RBTree(alloc) {
+    if (other.size_ > 0) {
       copyFromOther(other);
     }
   }
   // конструктор переноса, обмен данными с other
-  RBTree(tree_type &&other) noexcept : RBTree() { swap(other); }
+  RBTree(tree_type &&other) noexcept : RBTree(other.get_allocator()) {
+    swap(other);
+  }
 
-  // Присваивание копированием
+  // Перенос в память alloc: узлы other забираются, только если alloc может
+  // их освободить, иначе ключи переносятся в новые узлы
+  RBTree(tree_type &&other, const allocator_type &alloc) : RBTree(alloc) {
+    if (get_allocator() == other.get_allocator()) {
+      swap(other);
+    } else {
+      MoveKeysFrom(other);
+    }
+  }
+
+  // Присваивание копированием. Аллокатор other переходит к нам, только если
+  // этого требует propagate_on_container_copy_assignment
   tree_type &operator=(const tree_type &other) {
-    if (this != other) {
+    if (this != &other) {
+      if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                        value) {
+        if (get_allocator() != other.get_allocator()) {
+          tree_type tmp(other, other.get_allocator());
+          swap(tmp);
+          return *this;
+        }
+      }
       if (other._size_() > 0) {
         copyFromOther(other);
       } else {
@@ -61,33 +156,57 @@ class RBTree {
     }
     return *this;
   }
-  // Присваивание переносом
-  tree_type &operator=(tree_type &&other) noexcept {
-    clear();
-    swap(other);
+  // Присваивание переносом. Узлы other забираются целиком, если аллокаторы
+  // равны или аллокатор переходит вместе с ними, иначе ключи переносятся
+  // в новые узлы
+  tree_type &operator=(tree_type &&other) noexcept(
+      kMoveStealsMemory<Allocator>) {
+    if constexpr (kMoveStealsMemory<Allocator>) {
+      clear();
+      swap(other);
+    } else if (get_allocator() == other.get_allocator()) {
+      clear();
+      swap(other);
+    } else {
+      MoveKeysFrom(other);
+    }
     return *this;
   }
   // деструктор
   ~RBTree() {
     clear();
-    delete head_;
+    DestroyHead(head_);
     // делаем указатель, чтобы избежать дальнейшие сбои
     head_ = nullptr;
   }
 
+  // Аллокатор дерева
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(alloc_.get_allocator());
+  }
+
   // возвращает кол-во эл-ов в контейнере
   size_type _size_() const noexcept { return size_; }
 
-  // Обменивает содержимое одного контейнера на содержимое контейнера other
+  // Обменивает содержимое одного контейнера на содержимое контейнера other.
+  // Служебный узел и пул(а с ним и аллокатор) переходят вместе с узлами
   void swap(tree_type &other) noexcept {
     std::swap(head_, other.head_);
     std::swap(size_, other.size_);
     std::swap(cmp_, other.cmp_);
+    std::swap(standalone_, other.standalone_);
+    alloc_.swap(other.alloc_);
   }
 
-  // Удаляет содержимое контейнера
+  // Удаляет содержимое контейнера. Если ключи не требуют деструктора, а пул
+  // умеет освобождать память целиком, то по узлам даже не проходим. Узлы
+  // вне пула(standalone_, пришли из node handle) освобождаются по одному
   void clear() noexcept {
-    destroy(Root());
+    if (!std::is_trivially_destructible<key_type>::value ||
+        !node_allocator::kBulkRelease || standalone_ != 0) {
+      destroy(Root());
+    }
+    if (node_allocator::kBulkRelease) alloc_.release();
     InitializerHead();
     size_ = 0;
   }
@@ -124,35 +243,24 @@ class RBTree {
   // конст end
   const_iterator end_() const noexcept { return const_iterator(head_); }
 
-  // Мерджим элементы из other в this
+  // Мерджим элементы из other в this. При равных аллокаторах узлы other не
+  // копируются, а перевешиваются в это дерево(см. AdoptAll). При разных
+  // ключи сначала переносятся в новые узлы, и если это бросит исключение,
+  // оба дерева не изменятся
   void Merge_(tree_type &other) {
-    if (this != &other) {
-      iterator anotherBegin = other.begin_();
-      while (other.size_ > 0) {
-        tree_node *mvgNode = anotherBegin.node_;
-        ++anotherBegin;
-        if (mvgNode->left_ != nullptr)
-          mvgNode->left_->parent_ = mvgNode->parent_;
-        if (mvgNode->right_ != nullptr)
-          mvgNode->right_->parent_ = mvgNode->parent_;
-        if (mvgNode->parent_->left_ == mvgNode)
-          mvgNode->parent_->left_ = nullptr;
-        if (mvgNode->parent_->right_ == mvgNode)
-          mvgNode->parent_->right_ = nullptr;
-
-        mvgNode->ToDefaultNode();
-        --other.size_;
-        InsertKey(Root(), mvgNode, false);
-      }
-      other.InitializerHead();
-    }
+    if (this != &other) MoveNodes(AdoptAll(other).root);
   }
 
   // Извлекаем из other и вставляем в this,
   //  но если в this уже есть ключ который равен ключу в other, то ничего не
-  //  извлечется
+  //  извлечется. Пулы деревьев остаются раздельными. Если в other не
+  //  остается ни одного узла из его пула(TakePoolIfAllLeave), блоки пула
+  //  other переходят к нам и узлы перевешиваются без копирования: адреса
+  //  элементов сохраняются. Иначе ключи переносятся в новые узлы нашего
+  //  пула(AdoptNode). Оставшиеся в other элементы не трогаются
   void UniqueMerge(tree_type &other) {
     if (this != &other) {
+      bool relink = TakePoolIfAllLeave(other);
       iterator o_begin = other.begin_();
       iterator o_end = other.end_();
 
@@ -161,7 +269,7 @@ class RBTree {
         if (res == end_()) {
           iterator tmp = o_begin;
           ++o_begin;
-          tree_node *mvg_node = other.ExtractionNode(tmp);
+          tree_node *mvg_node = AdoptNode(other, tmp, relink);
           InsertKey(Root(), mvg_node, false);
         } else {
           ++o_begin;
@@ -170,10 +278,71 @@ class RBTree {
     }
   }
 
+  // Заполняет дерево элементами диапазона [first, last). Если диапазон уже
+  // отсортирован(для уникального дерева - строго по возрастанию), то дерево
+  // строится за линейное время через AssignSorted, иначе - обычными вставками
+  template <typename InputIt>
+  void AssignRange(InputIt first, InputIt last, bool uniq) {
+    AssignRange(first, last, uniq,
+                typename std::iterator_traits<InputIt>::iterator_category{});
+  }
+
+  // Строит идеально сбалансированное КЧ дерево из отсортированного диапазона
+  // [first, last) за O(n) без единого сравнения и поворота. Отсортированность
+  // гарантирует вызывающий. Память под все узлы берется у пула одним блоком.
+  // Раскраска: все уровни кроме последнего заполнены полностью и черные,
+  // узлы последнего неполного уровня - красные, поэтому черная высота любого
+  // пути одинакова
+  template <typename ForwardIt>
+  void AssignSorted(ForwardIt first, ForwardIt last) {
+    clear();
+    size_type count = static_cast<size_type>(std::distance(first, last));
+    if (count == 0) return;
+    alloc_.reserve(count);
+    // глубина первого неполного уровня: floor(log2(count + 1))
+    size_type red_depth = 0;
+    while ((size_type{2} << red_depth) - 1 <= count) ++red_depth;
+
+    tree_node *root = BuildSorted(first, count, 0, red_depth);
+    root->parent_ = head_;
+    Root() = root;
+    MostLeft() = MinimumSearch(root);
+    MostRight() = MaximumSearch(root);
+    size_ = count;
+  }
+
+  // Теоретико-множественные операции. other полностью поглощается: его узлы
+  // либо перевешиваются в это дерево, либо удаляются. При равных
+  // аллокаторах блоки пула other переходят к нам вместе с узлами
+  // (AdoptAll), и ни один узел не копируется и не выделяется. При разных
+  // аллокаторах ключи other сначала переносятся в новые узлы нашей памяти,
+  // и если это бросит исключение, оба дерева не изменятся.
+  // Для уникального дерева используется split/join: на каждом шаге other
+  // режется по ключу корня и части склеиваются обратно, всего
+  // O(m log(n / m + 1)), где m - размер меньшего дерева. Для дерева с
+  // повторами(multiset) - слияние отсортированных цепочек узлов за O(n + m)
+  // с последующей линейной пересборкой дерева.
+  // При совпадении ключей остается элемент этого дерева
+
+  // this = this ∪ other(для повторов - максимум из кратностей)
+  void SetUnion(tree_type &other, bool uniq) {
+    SetOperation(other, uniq, kUnion);
+  }
+
+  // this = this ∩ other(для повторов - минимум из кратностей)
+  void SetIntersection(tree_type &other, bool uniq) {
+    SetOperation(other, uniq, kIntersection);
+  }
+
+  // this = this \ other(для повторов - разность кратностей)
+  void SetDifference(tree_type &other, bool uniq) {
+    SetOperation(other, uniq, kDifference);
+  }
+
   // итератор для вставки в контейнер элемента, если есть уже такой
   // ключ вставка производится по верхней границе диапазона
   iterator InsertKey(const key_type &key) {
-    tree_node *new_tmp = new tree_node{key};
+    tree_node *new_tmp = CreateNode(key);
     return InsertKey(Root(), new_tmp, false).first;
   }
 
@@ -182,52 +351,93 @@ class RBTree {
   // переменная(true-получилось вставить, false-нет)
   std::pair<iterator, bool> UniqueInsert(const key_type &key) {
     // создаем новый узел
-    tree_node *tmp = new tree_node{key};
+    tree_node *tmp = CreateNode(key);
     std::pair<iterator, bool> res = InsertKey(Root(), tmp, true);
     if (!res.second)
       // если вставить не получается, удаляем узел tmp
-      delete tmp;
+      DestroyNode(tmp);
     return res;
   }
 
-  // Размещает новые элементы в контейнер(элементы args)
-  // Если элемент с таким key уже есть, то вставка осуществляется по верхней
-  // границе Мы должны сохранить главное отличие Emplace от insert(избежать не
-  // нужных копирований) Поэтому мы будем созданный аргумент передавать по
-  // функциям без копирования! Так как функция может вернуть несколько значений,
-  // используем вектор который содержит пары iterator,bool
+  // Вставка ключа key с подсказкой hint(см. приватную InsertHint).
+  // Если uniq и такой ключ уже есть - возвращает его и false
+  std::pair<iterator, bool> InsertKey(const_iterator hint, const key_type &key,
+                                      bool uniq) {
+    tree_node *tmp = CreateNode(key);
+    std::pair<iterator, bool> res = InsertHint(hint, tmp, uniq);
+    if (!res.second) DestroyNode(tmp);
+    return res;
+  }
+
+  // Создает элемент из args и вставляет его с подсказкой hint
   template <typename... Args>
-  std::vector<std::pair<iterator, bool>> emplace_(Args &&...args) {
-    std::vector<std::pair<iterator, bool>> res;
-    // Нам заранее известен args, поэтому сразу выделяем память(чтобы
-    // дополнительно в цикле не выделять)
-    res.reserve(sizeof...(args));
-    // используем std::forward и далее std::move чтобы избежать лишних
-    // копирований
-    for (auto i : {std::forward<Args>(args)...}) {
-      tree_node *tmp = new tree_node(std::move(i));
-      std::pair<iterator, bool> res_ins = InsertKey(Root(), tmp, false);
-      res.push_back(res_ins);
+  std::pair<iterator, bool> EmplaceHint(const_iterator hint, bool uniq,
+                                        Args &&...args) {
+    tree_node *tmp = CreateNode(std::forward<Args>(args)...);
+    std::pair<iterator, bool> res = InsertHint(hint, tmp, uniq);
+    if (!res.second) DestroyNode(tmp);
+    return res;
+  }
+
+  // Спуск за ключом key, который сравним с элементами через cmp_(например,
+  // ключ словаря без значения). Если ключ найден - возвращается его позиция,
+  // иначе узел создается на месте из args и подвешивается к родителю,
+  // запомненному при спуске. Одно прохождение дерева и никаких временных
+  // элементов для поиска
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> FindOrEmplace(const K &key, Args &&...args) {
+    tree_node *tmp = Root();
+    tree_node *parent = nullptr;
+    bool to_left = false;
+
+    while (tmp != nullptr) {
+      parent = tmp;
+      if (cmp_(key, tmp->key_)) {
+        tmp = tmp->left_;
+        to_left = true;
+      } else if (cmp_(tmp->key_, key)) {
+        tmp = tmp->right_;
+        to_left = false;
+      } else {
+        return {iterator(tmp), false};
+      }
     }
+    tree_node *node = CreateNode(std::forward<Args>(args)...);
+    return {iterator(AttachNode(parent, node, to_left)), true};
+  }
+
+  // Создает один элемент прямо в новом узле из аргументов конструктора args
+  // (без временного объекта и копирования) и вставляет его. Для уникального
+  // дерева(uniq) при совпадении ключа узел удаляется
+  template <typename... Args>
+  std::pair<iterator, bool> Emplace(bool uniq, Args &&...args) {
+    tree_node *tmp = CreateNode(std::forward<Args>(args)...);
+    std::pair<iterator, bool> res = InsertKey(Root(), tmp, uniq);
+    if (!res.second) DestroyNode(tmp);
     return res;
   }
 
-  // Размещает новые(уникальные) элементы в контейнер(элементы args)
+  // Вставляет несколько элементов args(каждый - готовое значение или то,
+  // из чего оно создается). Так как функция может вернуть несколько
+  // значений, используем вектор который содержит пары iterator,bool
   template <typename... Args>
-  std::vector<std::pair<iterator, bool>> UniqEmplace(Args &&...args) {
+  std::vector<std::pair<iterator, bool>> InsertMany(bool uniq,
+                                                    Args &&...args) {
     std::vector<std::pair<iterator, bool>> res;
+    // Нам заранее известен args, поэтому сразу выделяем память
     res.reserve(sizeof...(args));
-    for (auto i : {std::forward<Args>(args)...}) {
-      tree_node *tmp = new tree_node(std::move(i));
-      std::pair<iterator, bool> res_ins = InsertKey(Root(), tmp, false);
-      if (res_ins.second == false) delete tmp;
-      res.push_back(res_ins);
-    }
+    (res.push_back(Emplace(uniq, std::forward<Args>(args))), ...);
     return res;
   }
 
+  // Функции поиска принимают любой ключ K, который компаратор умеет
+  // сравнивать с элементами(cmp_(key, elem) и cmp_(elem, key)): сам элемент,
+  // ключ словаря без значения или, при прозрачном компараторе, любой
+  // сравнимый тип(например std::string_view для std::string)
+
   // функция для поиска элемента с ключом key
-  iterator Find(const_reference key) {
+  template <typename K>
+  iterator Find(const K &key) {
     iterator res = LowBow(key);
     if (res == end_() || cmp_(key, *res))
       // Если нижняя граница не нашлась, или нашел элемент > key
@@ -236,9 +446,16 @@ class RBTree {
     return res;
   }
 
+  // const версия Find
+  template <typename K>
+  const_iterator Find(const K &key) const {
+    return const_cast<tree_type *>(this)->Find(key);
+  }
+
   // а данная функция нужна для поиска минимального элемента который не меньше
   //  key
-  iterator LowBow(const_reference key) {
+  template <typename K>
+  iterator LowBow(const K &key) {
     // начнем искать с корня
     tree_node *begin = Root();
     // Если ничего не найдем, то используется значение по-умолчанию(end)
@@ -259,8 +476,15 @@ class RBTree {
     return iterator(res);
   }
 
-  // аналогичная функция LowBow, только наоборот
-  iterator UppBow(const_reference key) {
+  // const версия LowBow
+  template <typename K>
+  const_iterator LowBow(const K &key) const {
+    return const_cast<tree_type *>(this)->LowBow(key);
+  }
+
+  // аналогичная функция LowBow, только ищет первый элемент строго больше key
+  template <typename K>
+  iterator UppBow(const K &key) {
     // начнем искать с корня
     tree_node *begin = Root();
     // Если ничего не найдем, то используется значение по-умолчанию(end)
@@ -268,7 +492,7 @@ class RBTree {
     // Идем циклом пока не дойдем до нуллптр(в пустом дереве, мы даже не зайдем
     // в цикл)
     while (begin != nullptr) {
-      if (cmp_(begin->key_, key)) {
+      if (cmp_(key, begin->key_)) {
         // если нашли элемент, то запоминаем его как предварительный,
         // если найдем новые элементы(ниже по дереву), то обновим значение
         res = begin;
@@ -281,10 +505,113 @@ class RBTree {
     return iterator(res);
   }
 
+  // const версия UppBow
+  template <typename K>
+  const_iterator UppBow(const K &key) const {
+    return const_cast<tree_type *>(this)->UppBow(key);
+  }
+
+  // Количество элементов, эквивалентных key
+  template <typename K>
+  size_type CountKey(const K &key) const {
+    size_type res = 0;
+    for (const_iterator it = LowBow(key); it != end_() && !cmp_(key, *it);
+         ++it)
+      ++res;
+    return res;
+  }
+
+  // Извлекает узел на позиции pos из дерева. Node handle владеет узлом
+  // целиком и не держит пул дерева, поэтому узел должен быть отдельным
+  // выделением у аллокатора(узел вне пула, standalone_). Такой узел и узел
+  // NodeHeapAllocator отдаются как есть. Ключ узла из блока пула один раз
+  // переносится в новый узел вне пула(выделение памяти, при исключении
+  // дерево не меняется). Дальше узел переходит между деревьями с равными
+  // аллокаторами без копирования. Узел можно вставить обратно(в том числе
+  // с измененным ключом) или в другое дерево через InsertNode
+  node_type Extract(const_iterator pos) {
+    S21_ITERATOR_CHECK(OwnsNode(pos.node_), "iterator of another tree");
+    iterator it(const_cast<tree_node *>(pos.node_));
+    if (it == end_()) return node_type();
+    tree_node *node = it.node_;
+    if (node->standalone_) {
+      --standalone_;
+    } else if (!node_allocator::kIndividualNodes) {
+      tree_node *res = CreateStandalone(std::move(node->key_));
+      DestroyNode(ExtractionNode(it));
+      return node_type(res, get_allocator());
+    }
+    node = ExtractionNode(it);
+    node->standalone_ = true;
+    return node_type(node, get_allocator());
+  }
+
+  // Извлекает первый элемент с ключом key(пустой node handle, если его нет)
+  template <typename K>
+  node_type ExtractKey(const K &key) {
+    return Extract(Find(key));
+  }
+
+  // Вставляет узел из node handle. При равных аллокаторах узел просто
+  // подвешивается к дереву(как узел вне пула): адрес элемента сохраняется,
+  // даже если узел пришел из другого контейнера. Только при разных
+  // аллокаторах ключ переносится в новый узел нашей памяти(выделение), а
+  // старый узел освобождается. Если вставка не удалась(uniq и ключ уже
+  // есть), то узел остается в node
+  std::pair<iterator, bool> InsertNode(node_type &node, bool uniq) {
+    if (node.empty()) return {end_(), false};
+    tree_node *tmp = node.node_;
+    if (get_allocator() == *node.alloc_) {
+      node.node_ = nullptr;
+      node.alloc_.reset();
+    } else {
+      tmp = CreateStandalone(std::move(node.node_->key_));
+      node.Reset();
+    }
+    ++standalone_;
+    std::pair<iterator, bool> res = InsertKey(Root(), tmp, uniq);
+    if (!res.second) {
+      --standalone_;
+      node = node_type(tmp, get_allocator());
+    }
+    return res;
+  }
+
+  // Возвращает итератор на k-й по порядку элемент(нумерация с нуля) или
+  // end_(), если k >= размера. Требует политику OrderStatistic
+  iterator FindByOrder(size_type k) noexcept {
+    return iterator(const_cast<tree_node *>(SelectNode(k)));
+  }
+
+  const_iterator FindByOrder(size_type k) const noexcept {
+    return const_iterator(SelectNode(k));
+  }
+
+  // Возвращает количество элементов строго меньших key. Требует политику
+  // OrderStatistic
+  template <typename K>
+  size_type OrderOfKey(const K &key) const noexcept {
+    static_assert(Statistic::kEnabled,
+                  "OrderOfKey requires the OrderStatistic policy");
+    const tree_node *node = Root();
+    size_type res = 0;
+    while (node != nullptr) {
+      if (cmp_(node->key_, key)) {
+        // узел и все его левое поддерево меньше key
+        res += Count(node->left_) + 1;
+        node = node->right_;
+      } else {
+        node = node->left_;
+      }
+    }
+    return res;
+  }
+
   // Удаление элемента на определенной позиции
-  void Erase(iterator ind) noexcept {
+  void Erase(iterator ind) noexcept(!kCheckedIterators) {
+    S21_ITERATOR_CHECK(OwnsNode(ind.node_), "iterator of another tree");
     tree_node *res = ExtractionNode(ind);
-    delete res;
+    if (res != nullptr) DestroyNode(res);
   }
 
   // Проверка на корректность дерева
@@ -298,24 +625,735 @@ class RBTree {
     if (Root()->color_ != tBlack) return false;
 
     // У красного узла все потомки черные
-    if (!RedCheckNode(Root()->color_)) return false;
+    if (!RedCheckNode(Root())) return false;
 
     // Любой простой путь от узла-предка до потомка содержит одинаковое кол-во
     // черных узлов
 
     if (BlackHeight(Root()) == -1) return false;
 
+    // Размеры поддеревьев(если статистика включена) должны быть верными
+    if (!StatisticCheck(Root(), statistic_tag{})) return false;
+
     // Если мы дошли до этого момента-поздравляю, дерево корректно
     return true;
   }
 
  private:
+  // Для прямых итераторов сначала проверяем отсортированность за один проход,
+  // ничего не выделяя
+  template <typename ForwardIt>
+  void AssignRange(ForwardIt first, ForwardIt last, bool uniq,
+                   std::forward_iterator_tag) {
+    ForwardIt unsorted = std::adjacent_find(
+        first, last, [this, uniq](const key_type &lhs, const key_type &rhs) {
+          return uniq ? !cmp_(lhs, rhs) : cmp_(rhs, lhs);
+        });
+    if (unsorted == last) {
+      AssignSorted(first, last);
+    } else {
+      clear();
+      for (; first != last; ++first) InsertRangeItem(*first, uniq);
+    }
+  }
+
+  // Однопроходный диапазон второй раз не прочитать - только вставки
+  template <typename InputIt>
+  void AssignRange(InputIt first, InputIt last, bool uniq,
+                   std::input_iterator_tag) {
+    clear();
+    for (; first != last; ++first) InsertRangeItem(*first, uniq);
+  }
+
+  void InsertRangeItem(const key_type &key, bool uniq) {
+    if (uniq)
+      UniqueInsert(key);
+    else
+      InsertKey(key);
+  }
+
+  // Рекурсивно строит поддерево из count следующих элементов диапазона,
+  // first сдвигается на count позиций. Если на каком-то узле вылетело
+  // исключение, то уже построенные поддеревья удаляются
+  template <typename ForwardIt>
+  tree_node *BuildSorted(ForwardIt &first, size_type count, size_type depth,
+                         size_type red_depth) {
+    if (count == 0) return nullptr;
+    size_type left_count = (count - 1) / 2;
+    tree_node *left = BuildSorted(first, left_count, depth + 1, red_depth);
+    tree_node *node = nullptr;
+    try {
+      node = CreateNode(*first);
+    } catch (...) {
+      destroy(left);
+      throw;
+    }
+    ++first;
+    node->color_ = depth == red_depth ? tRed : tBlack;
+    SetCount(node, count, statistic_tag{});
+    node->left_ = left;
+    if (left != nullptr) left->parent_ = node;
+    try {
+      node->right_ =
+          BuildSorted(first, count - left_count - 1, depth + 1, red_depth);
+    } catch (...) {
+      destroy(node);
+      throw;
+    }
+    if (node->right_ != nullptr) node->right_->parent_ = node;
+    return node;
+  }
+
   // Рекурсивно удаляет все узлы и освобождает память(кроме узла head_)
   void destroy(tree_node *node) noexcept {
     if (node == nullptr) return;
     destroy(node->left_);
     destroy(node->right_);
-    delete node;
+    DestroyNode(node);
+  }
+
+  // Создает узел в памяти пула. Ключ создается из args через аллокатор
+  // дерева, поэтому ресурс std::pmr доходит и до ключей, которые его
+  // принимают(например std::pmr::string)
+  template <typename... Args>
+  tree_node *CreateNode(Args &&...args) {
+    tree_node *node = alloc_.allocate();
+    new (node) tree_node();
+    try {
+      key_allocator alloc(alloc_.get_allocator());
+      key_traits::construct(alloc, std::addressof(node->key_),
+                            std::forward<Args>(args)...);
+    } catch (...) {
+      node->~tree_node();
+      alloc_.deallocate(node);
+      throw;
+    }
+    return node;
+  }
+
+  // Разрушает узел и возвращает его память пулу(узел вне пула - прямо
+  // аллокатору)
+  void DestroyNode(tree_node *node) noexcept {
+    if (node->standalone_) {
+      --standalone_;
+      DestroyStandalone(get_allocator(), node);
+      return;
+    }
+    key_allocator alloc(alloc_.get_allocator());
+    key_traits::destroy(alloc, std::addressof(node->key_));
+    node->~tree_node();
+    alloc_.deallocate(node);
+  }
+
+  // Узел вне пула: отдельное выделение у аллокатора дерева, как у head_.
+  // Им владеет node handle, и такой узел может жить в любом дереве с равным
+  // аллокатором
+  template <typename... Args>
+  tree_node *CreateStandalone(Args &&...args) {
+    head_allocator alloc(alloc_.get_allocator());
+    tree_node *node = head_traits::allocate(alloc, 1);
+    new (node) tree_node();
+    try {
+      key_allocator key_alloc(alloc);
+      key_traits::construct(key_alloc, std::addressof(node->key_),
+                            std::forward<Args>(args)...);
+    } catch (...) {
+      node->~tree_node();
+      head_traits::deallocate(alloc, node, 1);
+      throw;
+    }
+    node->standalone_ = true;
+    return node;
+  }
+
+  static void DestroyStandalone(const allocator_type &allocator,
+                                tree_node *node) noexcept {
+    key_allocator key_alloc(allocator);
+    key_traits::destroy(key_alloc, std::addressof(node->key_));
+    node->~tree_node();
+    head_allocator alloc(allocator);
+    head_traits::deallocate(alloc, node, 1);
+  }
+
+  // Служебный узел head_ выделяется отдельно от пула(clear() освобождает
+  // пул целиком), но тем же аллокатором. Ключа у него нет
+  tree_node *CreateHead() {
+    head_allocator alloc(alloc_.get_allocator());
+    tree_node *head = head_traits::allocate(alloc, 1);
+    new (head) tree_node();
+    head->left_ = head;
+    head->right_ = head;
+    return head;
+  }
+
+  void DestroyHead(tree_node *head) noexcept {
+    head_allocator alloc(alloc_.get_allocator());
+    head->~tree_node();
+    head_traits::deallocate(alloc, head, 1);
+  }
+
+  // Заменяет содержимое ключами other(перемещением), other очищается.
+  // Ключи other уже упорядочены, поэтому дерево строится за O(n)
+  void MoveKeysFrom(tree_type &other) {
+    cmp_ = other.cmp_;
+    AssignSorted(std::make_move_iterator(other.begin_()),
+                 std::make_move_iterator(other.end_()));
+    other.clear();
+  }
+
+  // Размер поддерева node(для пустого поддерева - 0)
+  static size_type Count(const tree_node *node) noexcept {
+    return node == nullptr ? 0 : node->count_;
+  }
+
+  // Пересчитывает размер поддерева node по его потомкам. Без статистики
+  // порядка все эти функции пустые и исчезают при компиляции
+  void Recount(tree_node *, std::false_type) noexcept {}
+
+  void Recount(tree_node *node, std::true_type) noexcept {
+    node->count_ = Count(node->left_) + Count(node->right_) + 1;
+  }
+
+  // Прибавляет delta к размерам поддеревьев всех предков node
+  void AddToAncestors(tree_node *, int, std::false_type) noexcept {}
+
+  void AddToAncestors(tree_node *node, int delta, std::true_type) noexcept {
+    for (tree_node *cur = node->parent_; cur != head_; cur = cur->parent_) {
+      cur->count_ += delta;
+    }
+  }
+
+  void SetCount(tree_node *, size_type, std::false_type) noexcept {}
+
+  void SetCount(tree_node *node, size_type count, std::true_type) noexcept {
+    node->count_ = count;
+  }
+
+  void SwapCount(tree_node *, tree_node *, std::false_type) noexcept {}
+
+  void SwapCount(tree_node *lhs, tree_node *rhs, std::true_type) noexcept {
+    std::swap(lhs->count_, rhs->count_);
+  }
+
+  bool StatisticCheck(const tree_node *, std::false_type) const noexcept {
+    return true;
+  }
+
+  bool StatisticCheck(const tree_node *node, std::true_type) const noexcept {
+    if (node == nullptr) return true;
+    return node->count_ == Count(node->left_) + Count(node->right_) + 1 &&
+           StatisticCheck(node->left_, statistic_tag{}) &&
+           StatisticCheck(node->right_, statistic_tag{});
+  }
+
+  // Спуск к k-му элементу по размерам левых поддеревьев
+  const tree_node *SelectNode(size_type k) const noexcept {
+    static_assert(Statistic::kEnabled,
+                  "FindByOrder requires the OrderStatistic policy");
+    const tree_node *node = Root();
+    while (node != nullptr) {
+      size_type left = Count(node->left_);
+      if (k < left) {
+        node = node->left_;
+      } else if (k == left) {
+        return node;
+      } else {
+        k -= left + 1;
+        node = node->right_;
+      }
+    }
+    return head_;
+  }
+
+  // Поддерево, оторванное от дерева, вместе с его черной высотой(количество
+  // черных узлов на пути от корня до листа, корень учитывается)
+  struct SubTree {
+    tree_node *root;
+    int height;
+  };
+
+  enum SetOperationType { kUnion, kIntersection, kDifference };
+
+  void SetOperation(tree_type &other, bool uniq, SetOperationType type) {
+    if (this == &other) {
+      if (type == kDifference) clear();
+      return;
+    }
+    size_type total = size_ + other.size_;
+    // единственный шаг, который может бросить, - до изменения деревьев
+    SubTree rhs = AdoptAll(other);
+    SubTree lhs = DetachRoot();
+    size_ = 0;
+
+    if (uniq) {
+      size_type dropped = 0;
+      SubTree res;
+      if (type == kUnion)
+        res = UnionNodes(lhs, rhs, dropped);
+      else if (type == kIntersection)
+        res = IntersectNodes(lhs, rhs, dropped);
+      else
+        res = DifferenceNodes(lhs, rhs, dropped);
+      InstallRoot(res.root, total - dropped);
+    } else {
+      MergeChains(lhs.root, rhs.root, type);
+    }
+  }
+
+  // Отрывает корень от головы дерева, дерево становится пустым(кроме пула)
+  SubTree DetachRoot() noexcept {
+    SubTree res{Root(), BlackHeightOf(Root())};
+    if (res.root != nullptr) res.root->parent_ = nullptr;
+    InitializerHead();
+    return res;
+  }
+
+  // Делает node корнем дерева из count элементов
+  void InstallRoot(tree_node *node, size_type count) noexcept {
+    InitializerHead();
+    size_ = count;
+    if (node == nullptr) return;
+    node->parent_ = head_;
+    node->color_ = tBlack;
+    Root() = node;
+    MostLeft() = MinimumSearch(node);
+    MostRight() = MaximumSearch(node);
+  }
+
+  static int BlackHeightOf(const tree_node *node) noexcept {
+    int res = 0;
+    for (; node != nullptr; node = node->left_) {
+      if (node->color_ == tBlack) ++res;
+    }
+    return res;
+  }
+
+  // Отрывает потомка от родителя и возвращает его как самостоятельное
+  // поддерево, height - черная высота родителя
+  static SubTree TakeChild(tree_node *child, const tree_node *parent,
+                           int height) noexcept {
+    if (child != nullptr) child->parent_ = nullptr;
+    return {child, parent->color_ == tBlack ? height - 1 : height};
+  }
+
+  // Пересчитывает размеры поддеревьев от node до корня
+  void RecountUp(tree_node *, std::false_type) noexcept {}
+
+  void RecountUp(tree_node *node, std::true_type) noexcept {
+    for (; node != nullptr && node != head_; node = node->parent_) {
+      Recount(node, statistic_tag{});
+    }
+  }
+
+  // join: склеивает left, узел key_node и right при условии
+  // left < key_node < right. Узел опускается по правому(левому) краю более
+  // высокого дерева до черного узла той же черной высоты, что у низкого
+  // дерева, встает на его место красным и дальше работает обычная
+  // балансировка после вставки. Время O(|разница черных высот| + 1)
+  SubTree JoinNodes(SubTree left, tree_node *key_node, SubTree right) {
+    Blacken(left);
+    Blacken(right);
+    key_node->parent_ = nullptr;
+    key_node->color_ = tRed;
+    if (left.height == right.height) {
+      key_node->color_ = tBlack;
+      LinkChildren(key_node, left.root, right.root);
+      return {key_node, left.height + 1};
+    }
+
+    bool to_right = left.height > right.height;
+    SubTree &tall = to_right ? left : right;
+    const SubTree &low = to_right ? right : left;
+    tree_node *parent = nullptr;
+    tree_node *cur = tall.root;
+    int height = tall.height;
+    while (height != low.height || (cur != nullptr && cur->color_ == tRed)) {
+      if (cur->color_ == tBlack) --height;
+      parent = cur;
+      cur = to_right ? cur->right_ : cur->left_;
+    }
+    if (to_right) {
+      LinkChildren(key_node, cur, low.root);
+      parent->right_ = key_node;
+    } else {
+      LinkChildren(key_node, low.root, cur);
+      parent->left_ = key_node;
+    }
+    key_node->parent_ = parent;
+    RecountUp(parent, statistic_tag{});
+
+    // Голова пустого на время операции дерева служит временным заголовком,
+    // чтобы переиспользовать BalancingInsertTree и повороты
+    Root() = tall.root;
+    tall.root->parent_ = head_;
+    bool grown = BalancingInsertTree(key_node);
+    SubTree res{Root(), tall.height + (grown ? 1 : 0)};
+    res.root->parent_ = nullptr;
+    Root() = nullptr;
+    return res;
+  }
+
+  // join без разделяющего узла: разделителем становится максимум left
+  SubTree JoinNodes(SubTree left, SubTree right) {
+    if (left.root == nullptr) return right;
+    if (right.root == nullptr) return left;
+    tree_node *last = nullptr;
+    SubTree rest = SplitLast(left, last);
+    return JoinNodes(rest, last, right);
+  }
+
+  // Отрывает максимальный узел поддерева
+  SubTree SplitLast(SubTree tree, tree_node *&last) {
+    tree_node *node = tree.root;
+    if (node->right_ == nullptr) {
+      last = node;
+      SubTree rest = TakeChild(node->left_, node, tree.height);
+      node->left_ = nullptr;
+      return rest;
+    }
+    SubTree left = TakeChild(node->left_, node, tree.height);
+    SubTree right = SplitLast(TakeChild(node->right_, node, tree.height), last);
+    return JoinNodes(left, node, right);
+  }
+
+  // split: делит поддерево по key на меньшие и большие key части, узел
+  // с ключом равным key(если он есть) возвращается отдельно
+  tree_node *SplitNodes(SubTree tree, const key_type &key, SubTree &less,
+                        SubTree &greater) {
+    tree_node *node = tree.root;
+    if (node == nullptr) {
+      less = greater = {nullptr, 0};
+      return nullptr;
+    }
+    SubTree left = TakeChild(node->left_, node, tree.height);
+    SubTree right = TakeChild(node->right_, node, tree.height);
+    if (cmp_(key, node->key_)) {
+      SubTree middle;
+      tree_node *found = SplitNodes(left, key, less, middle);
+      greater = JoinNodes(middle, node, right);
+      return found;
+    }
+    if (cmp_(node->key_, key)) {
+      SubTree middle;
+      tree_node *found = SplitNodes(right, key, middle, greater);
+      less = JoinNodes(left, node, middle);
+      return found;
+    }
+    less = left;
+    greater = right;
+    node->ToDefaultNode();
+    return node;
+  }
+
+  SubTree UnionNodes(SubTree lhs, SubTree rhs, size_type &dropped) {
+    if (rhs.root == nullptr) return lhs;
+    if (lhs.root == nullptr) return rhs;
+    tree_node *node = lhs.root;
+    SubTree lhs_less = TakeChild(node->left_, node, lhs.height);
+    SubTree lhs_greater = TakeChild(node->right_, node, lhs.height);
+    SubTree rhs_less, rhs_greater;
+    tree_node *twin = SplitNodes(rhs, node->key_, rhs_less, rhs_greater);
+    if (twin != nullptr) {
+      DestroyNode(twin);
+      ++dropped;
+    }
+    SubTree less = UnionNodes(lhs_less, rhs_less, dropped);
+    SubTree greater = UnionNodes(lhs_greater, rhs_greater, dropped);
+    return JoinNodes(less, node, greater);
+  }
+
+  SubTree IntersectNodes(SubTree lhs, SubTree rhs, size_type &dropped) {
+    if (lhs.root == nullptr || rhs.root == nullptr) {
+      dropped += DropNodes(lhs.root) + DropNodes(rhs.root);
+      return {nullptr, 0};
+    }
+    tree_node *node = lhs.root;
+    SubTree lhs_less = TakeChild(node->left_, node, lhs.height);
+    SubTree lhs_greater = TakeChild(node->right_, node, lhs.height);
+    SubTree rhs_less, rhs_greater;
+    tree_node *twin = SplitNodes(rhs, node->key_, rhs_less, rhs_greater);
+    SubTree less = IntersectNodes(lhs_less, rhs_less, dropped);
+    SubTree greater = IntersectNodes(lhs_greater, rhs_greater, dropped);
+    if (twin != nullptr) {
+      DestroyNode(twin);
+      ++dropped;
+      return JoinNodes(less, node, greater);
+    }
+    DestroyNode(node);
+    ++dropped;
+    return JoinNodes(less, greater);
+  }
+
+  SubTree DifferenceNodes(SubTree lhs, SubTree rhs, size_type &dropped) {
+    if (lhs.root == nullptr || rhs.root == nullptr) {
+      dropped += DropNodes(rhs.root);
+      return lhs;
+    }
+    tree_node *node = rhs.root;
+    SubTree rhs_less = TakeChild(node->left_, node, rhs.height);
+    SubTree rhs_greater = TakeChild(node->right_, node, rhs.height);
+    SubTree lhs_less, lhs_greater;
+    tree_node *twin = SplitNodes(lhs, node->key_, lhs_less, lhs_greater);
+    SubTree less = DifferenceNodes(lhs_less, rhs_less, dropped);
+    SubTree greater = DifferenceNodes(lhs_greater, rhs_greater, dropped);
+    DestroyNode(node);
+    ++dropped;
+    if (twin != nullptr) {
+      DestroyNode(twin);
+      ++dropped;
+    }
+    return JoinNodes(less, greater);
+  }
+
+  // Удаляет поддерево и возвращает количество удаленных узлов
+  size_type DropNodes(tree_node *node) noexcept {
+    if (node == nullptr) return 0;
+    size_type res = DropNodes(node->left_) + DropNodes(node->right_) + 1;
+    DestroyNode(node);
+    return res;
+  }
+
+  void Blacken(SubTree &tree) noexcept {
+    if (tree.root != nullptr && tree.root->color_ == tRed) {
+      tree.root->color_ = tBlack;
+      ++tree.height;
+    }
+  }
+
+  void LinkChildren(tree_node *node, tree_node *left,
+                    tree_node *right) noexcept {
+    node->left_ = left;
+    node->right_ = right;
+    if (left != nullptr) left->parent_ = node;
+    if (right != nullptr) right->parent_ = node;
+    Recount(node, statistic_tag{});
+  }
+
+  // Операции для дерева с повторами: оба дерева вытягиваются в
+  // отсортированные цепочки(через right_), сливаются с учетом кратностей,
+  // лишние узлы удаляются, а из результата заново строится дерево
+  void MergeChains(tree_node *lhs, tree_node *rhs, SetOperationType type) {
+    tree_node *lhs_chain = nullptr;
+    tree_node *rhs_chain = nullptr;
+    ChainNodes(lhs, lhs_chain);
+    ChainNodes(rhs, rhs_chain);
+
+    tree_node *res = nullptr;
+    tree_node **tail = &res;
+    size_type count = 0;
+    auto keep = [&tail, &count](tree_node *node) {
+      *tail = node;
+      tail = &node->right_;
+      ++count;
+    };
+    auto drop = [this](tree_node *node) { DestroyNode(node); };
+
+    while (lhs_chain != nullptr || rhs_chain != nullptr) {
+      bool take_lhs = rhs_chain == nullptr ||
+                      (lhs_chain != nullptr &&
+                       cmp_(lhs_chain->key_, rhs_chain->key_));
+      bool take_rhs = lhs_chain == nullptr ||
+                      (rhs_chain != nullptr &&
+                       cmp_(rhs_chain->key_, lhs_chain->key_));
+      if (take_lhs) {
+        // элемент есть только слева
+        tree_node *node = lhs_chain;
+        lhs_chain = lhs_chain->right_;
+        if (type == kIntersection)
+          drop(node);
+        else
+          keep(node);
+      } else if (take_rhs) {
+        // элемент есть только справа
+        tree_node *node = rhs_chain;
+        rhs_chain = rhs_chain->right_;
+        if (type == kUnion)
+          keep(node);
+        else
+          drop(node);
+      } else {
+        // пара равных элементов: остается левый, правый удаляется(кроме
+        // разности, где удаляются оба)
+        tree_node *node = lhs_chain;
+        lhs_chain = lhs_chain->right_;
+        tree_node *twin = rhs_chain;
+        rhs_chain = rhs_chain->right_;
+        drop(twin);
+        if (type == kDifference)
+          drop(node);
+        else
+          keep(node);
+      }
+    }
+    *tail = nullptr;
+
+    size_type red_depth = 0;
+    while ((size_type{2} << red_depth) - 1 <= count) ++red_depth;
+    tree_node *root = BuildLinked(res, count, 0, red_depth);
+    InstallRoot(root, count);
+  }
+
+  // Вытягивает поддерево в отсортированную цепочку, chain - начало цепочки
+  // из уже обработанных(больших) узлов
+  void ChainNodes(tree_node *node, tree_node *&chain) noexcept {
+    if (node == nullptr) return;
+    ChainNodes(node->right_, chain);
+    tree_node *left = node->left_;
+    node->right_ = chain;
+    chain = node;
+    ChainNodes(left, chain);
+  }
+
+  // Аналог BuildSorted, но узлы берутся из готовой цепочки, а не создаются
+  tree_node *BuildLinked(tree_node *&chain, size_type count, size_type depth,
+                         size_type red_depth) noexcept {
+    if (count == 0) return nullptr;
+    size_type left_count = (count - 1) / 2;
+    tree_node *left = BuildLinked(chain, left_count, depth + 1, red_depth);
+    tree_node *node = chain;
+    chain = chain->right_;
+    node->ToDefaultNode();
+    node->color_ = depth == red_depth ? tRed : tBlack;
+    SetCount(node, count, statistic_tag{});
+    node->left_ = left;
+    if (left != nullptr) left->parent_ = node;
+    node->right_ =
+        BuildLinked(chain, count - left_count - 1, depth + 1, red_depth);
+    if (node->right_ != nullptr) node->right_->parent_ = node;
+    return node;
+  }
+
+  // Если аллокаторы равны и после UniqueMerge в other не останется ни
+  // одного узла его пула(все повторы ключей - узлы вне пула), то все блоки
+  // пула other переходят к нам вместе с узлами и возвращается true. Узлы
+  // NodeHeapAllocator отдельны и переходят при любых повторах. Пул
+  // other остается пустым и по-прежнему только его
+  bool TakePoolIfAllLeave(tree_type &other) noexcept {
+    if (get_allocator() != other.get_allocator()) return false;
+    if (node_allocator::kIndividualNodes) return true;
+    for (iterator it = other.begin_(); it != other.end_(); ++it) {
+      if (!it.node_->standalone_ && Find(it.node_->key_) != end_())
+        return false;
+    }
+    alloc_.merge(other.alloc_);
+    return true;
+  }
+
+  // Извлекает узел pos из дерева owner и возвращает его в нашей памяти.
+  // relink - блоки пула owner уже наши(TakePoolIfAllLeave), тогда узел
+  // переходит как есть. Так же переходит узел вне пула при равных
+  // аллокаторах. Иначе ключ переносится в новый узел нашего пула(это
+  // выделение памяти), и только потом узел pos извлекается и возвращается
+  // owner, поэтому исключение не теряет элемент
+  tree_node *AdoptNode(tree_type &owner, iterator pos, bool relink) {
+    tree_node *node = pos.node_;
+    if (node->standalone_ && get_allocator() == owner.get_allocator()) {
+      --owner.standalone_;
+      ++standalone_;
+      return owner.ExtractionNode(pos);
+    }
+    if (relink) return owner.ExtractionNode(pos);
+    tree_node *res = CreateNode(RehomeKey(node->key_));
+    owner.DestroyNode(owner.ExtractionNode(pos));
+    return res;
+  }
+
+  // Все узлы other переходят к нам оторванным поддеревом, other становится
+  // пустым. При равных аллокаторах все блоки пула other переходят к нам
+  // вместе с узлами, и узлы остаются на своих местах. Пулы при этом не
+  // объединяются: пул other остается пустым и по-прежнему только его.
+  // Только при разных аллокаторах ключи переносятся в копию поддерева в
+  // нашей памяти(RehomeNodes), и лишь после ее успешной сборки other
+  // очищается: при исключении other не меняется
+  SubTree AdoptAll(tree_type &other) {
+    if (get_allocator() != other.get_allocator()) {
+      SubTree res{RehomeNodes(other.Root(), other.size_),
+                  BlackHeightOf(other.Root())};
+      other.clear();
+      return res;
+    }
+    alloc_.merge(other.alloc_);
+    standalone_ += std::exchange(other.standalone_, 0);
+    other.size_ = 0;
+    return other.DetachRoot();
+  }
+
+  // Ключ узла дерева с другим аллокатором для нового узла нашей памяти:
+  // перемещается, только если это не может бросить исключение(или ключ
+  // нельзя скопировать), иначе копируется, и при исключении исходный ключ
+  // остается целым
+  static decltype(auto) RehomeKey(key_type &key) noexcept {
+    constexpr bool by_move =
+        noexcept(key_traits::construct(std::declval<key_allocator &>(),
+                                       std::declval<key_type *>(),
+                                       std::declval<key_type &&>())) ||
+        !std::is_copy_constructible<key_type>::value;
+    if constexpr (by_move) {
+      return std::move(key);
+    } else {
+      return static_cast<const key_type &>(key);
+    }
+  }
+
+  // Копия поддерева node из count узлов(та же форма и раскраска) в нашей
+  // памяти. Сначала берется память под все узлы, затем создаются ключи
+  // (RehomeKey), поэтому при исключении все взятое возвращается, а исходное
+  // поддерево остается целым. Разрушить его вызывающий может после успеха
+  tree_node *RehomeNodes(tree_node *node, size_type count) {
+    tree_node *spare = nullptr;
+    try {
+      for (; count > 0; --count) {
+        tree_node *raw = alloc_.allocate();
+        new (raw) tree_node();
+        raw->right_ = spare;
+        spare = raw;
+      }
+      return CloneRehomed(node, nullptr, spare);
+    } catch (...) {
+      while (spare != nullptr) {
+        tree_node *next = spare->right_;
+        spare->~tree_node();
+        alloc_.deallocate(spare);
+        spare = next;
+      }
+      throw;
+    }
+  }
+
+  // Собирает копию поддерева node из заготовленных узлов цепочки spare
+  // (связанных через right_). При исключении уже собранная часть
+  // разрушается, а неиспользованные узлы остаются в spare
+  tree_node *CloneRehomed(tree_node *node, tree_node *parent,
+                          tree_node *&spare) {
+    if (node == nullptr) return nullptr;
+    tree_node *res = spare;
+    key_allocator alloc(alloc_.get_allocator());
+    key_traits::construct(alloc, std::addressof(res->key_),
+                          RehomeKey(node->key_));
+    spare = res->right_;
+    res->right_ = nullptr;
+    res->color_ = node->color_;
+    res->parent_ = parent;
+    try {
+      res->left_ = CloneRehomed(node->left_, res, spare);
+      res->right_ = CloneRehomed(node->right_, res, spare);
+    } catch (...) {
+      destroy(res);
+      throw;
+    }
+    Recount(res, statistic_tag{});
+    return res;
+  }
+
+  // Рекурсивно перевешивает все узлы поддерева node в это дерево
+  void MoveNodes(tree_node *node) {
+    if (node == nullptr) return;
+    tree_node *left = node->left_;
+    tree_node *right = node->right_;
+    MoveNodes(left);
+    MoveNodes(right);
+    node->ToDefaultNode();
+    InsertKey(Root(), node, false);
   }
 
   // Инициализация узла head
@@ -329,7 +1367,14 @@ class RBTree {
   tree_node *&Root() { return head_->parent_; }
 
   // const версия Root()
-  const tree_node *&Root() const { return head_->parent_; }
+  const tree_node *Root() const { return head_->parent_; }
+
+  // Принадлежит ли узел этому дереву: подъем по родителям до head_.
+  // Используется только в режиме S21_CHECKED_ITERATORS, O(log n)
+  bool OwnsNode(const tree_node *node) const noexcept {
+    while (!node->IsHead()) node = node->parent_;
+    return node == head_;
+  }
 
   tree_node *&MostLeft() { return head_->left_; }
 
@@ -340,14 +1385,18 @@ class RBTree {
   const tree_node *MostRight() const { return head_->right_; }
 
   [[nodiscard]] tree_node *copytree(const tree_node *node, tree_node *parent) {
-    tree_node *tmp = new tree_node{node->_key_, node->_color_};
+    tree_node *tmp = CreateNode(node->key_);
+    tmp->color_ = node->color_;
+    tmp->left_ = nullptr;
+    tmp->right_ = nullptr;
     try {
       if (node->left_) tmp->left_ = copytree(node->left_, tmp);
-      if (node->_right) tmp->right = copytree(node->left_, tmp);
+      if (node->right_) tmp->right_ = copytree(node->right_, tmp);
     } catch (...) {
-      Destroy(tmp);
+      destroy(tmp);
       throw;
     }
+    Recount(tmp, statistic_tag{});
 
     tmp->parent_ = parent;
     return tmp;
@@ -368,8 +1417,12 @@ class RBTree {
   }
 
   void copyFromOther(const tree_type &other) {
-    tree_node *tmp_copy_root = copytree(other.Root(), nullptr);
+    // копия строится в отдельном пуле, чтобы при исключении не потерять
+    // текущее содержимое
+    tree_type tmp_tree(get_allocator());
+    tree_node *tmp_copy_root = tmp_tree.copytree(other.Root(), nullptr);
     clear();
+    alloc_.swap(tmp_tree.alloc_);
     Root() = tmp_copy_root;
     Root()->parent_ = head_;
     MostLeft() = MinimumSearch(Root());
@@ -398,29 +1451,72 @@ class RBTree {
           else
             return {iterator(tmp), false};
         }
-        // РАЗОБРАТЬСЯ ПОЧЕМУ ТУТ УЛЕТАЕТ В БЕСКОНЕЧНЫЙ ЦИКЛ
       }
     }
+    bool to_left = parent != nullptr && cmp_(root->key_, parent->key_);
+    return {iterator(AttachNode(parent, root, to_left)), true};
+  }
+
+  // Вставка с подсказкой: hint - позиция, перед которой должен оказаться
+  // новый узел. Если ключ действительно лежит между предыдущим элементом и
+  // hint, то узел подвешивается сразу, без спуска от корня. Особенно дешево
+  // обходится вставка в конец(hint == end_()) - сравнение только с MostRight()
+  std::pair<iterator, bool> InsertHint(const_iterator hint, tree_node *node,
+                                       bool uniq) {
+    S21_ITERATOR_CHECK(OwnsNode(hint.node_), "iterator of another tree");
+    tree_node *pos = const_cast<tree_node *>(hint.node_);
+    if (size_ == 0) return InsertKey(Root(), node, uniq);
+
+    // Нестрогие сравнения для multiset, строгие для уникального дерева
+    auto before = [this, uniq](const key_type &lhs, const key_type &rhs) {
+      return uniq ? cmp_(lhs, rhs) : !cmp_(rhs, lhs);
+    };
+
+    if (pos == head_) {
+      if (before(MostRight()->key_, node->key_))
+        return {iterator(AttachNode(MostRight(), node, false)), true};
+    } else if (before(node->key_, pos->key_)) {
+      if (pos == MostLeft())
+        return {iterator(AttachNode(pos, node, true)), true};
+      tree_node *prev = pos->PrevNode();
+      if (before(prev->key_, node->key_)) {
+        // Между prev и pos всегда есть свободное место: либо левый потомок
+        // pos, либо правый потомок prev(prev - максимум левого поддерева pos)
+        if (pos->left_ == nullptr)
+          return {iterator(AttachNode(pos, node, true)), true};
+        return {iterator(AttachNode(prev, node, false)), true};
+      }
+    }
+    // Подсказка не подошла - обычная вставка со спуском от корня
+    return InsertKey(Root(), node, uniq);
+  }
+
+  // Подвешивает узел node к parent слева(to_left) или справа, если parent
+  // равен nullptr - node становится корнем. Обновляет размер, крайние узлы
+  // и балансирует дерево
+  tree_node *AttachNode(tree_node *parent, tree_node *node,
+                        bool to_left) noexcept {
     if (parent != nullptr) {
-      root->parent_ = parent;
-      if (cmp_(root->key_, parent->key_))
-        parent->left_ = root;
+      node->parent_ = parent;
+      if (to_left)
+        parent->left_ = node;
       else
-        parent->right_ = root;
+        parent->right_ = node;
     } else {
-      root->color_ = tBlack;
-      root->parent_ = head_;
-      Root() = root;
+      node->color_ = tBlack;
+      node->parent_ = head_;
+      Root() = node;
     }
     ++size_;
-    if (MostLeft() == head_ || MostLeft()->left_ != nullptr) {
-      MostLeft() = root;
+    AddToAncestors(node, 1, statistic_tag{});
+    if (parent == nullptr || (to_left && parent == MostLeft())) {
+      MostLeft() = node;
     }
-    if (MostRight() == head_ || MostRight()->right_ != nullptr) {
-      MostRight() = root;
+    if (parent == nullptr || (!to_left && parent == MostRight())) {
+      MostRight() = node;
     }
-    BalancingInsertTree(root);
-    return {iterator(root), true};
+    BalancingInsertTree(node);
+    return node;
   }
 
   // Для балансировки дерева нужно знать несколько правил:
@@ -434,7 +1530,9 @@ class RBTree {
   //  https://fkti5301.github.io/exam_tickets_aisd_2017_kolinko/tickets/12.html
   //  https://habr.com/ru/companies/otus/articles/472040/
   // Соответственно, для балансировки дерева нам понадобятся функции вращения
-  void BalancingInsertTree(tree_node *node) {
+  // Возвращает true, если балансировка перекрасила корень(черная высота
+  // дерева выросла на 1)
+  bool BalancingInsertTree(tree_node *node) {
     // Папа
     tree_node *father = node->parent_;
 
@@ -493,7 +1591,9 @@ class RBTree {
       }
     }
     // Корень всегда черный!
+    bool grown = Root()->color_ == tRed;
     Root()->color_ = tBlack;
+    return grown;
   }
 
   // функция поворота налево
@@ -519,6 +1619,9 @@ class RBTree {
     if (support->left_ != nullptr) support->left_->parent_ = node;
     node->parent_ = support;
     support->left_ = node;
+    // сначала пересчитываем опустившийся узел, затем поднявшийся
+    Recount(node, statistic_tag{});
+    Recount(support, statistic_tag{});
   }
 
   // функция поворота направо (делаем все аналогично как с поворотом
@@ -540,6 +1643,8 @@ class RBTree {
     if (support->right_ != nullptr) support->right_->parent_ = node;
     node->parent_ = support;
     support->right_ = node;
+    Recount(node, statistic_tag{});
+    Recount(support, statistic_tag{});
   }
 
   // можно много расписывать про извлечение узла дерева по определенной позиции,
@@ -596,6 +1701,7 @@ class RBTree {
       InitializerHead();
     else {
       // тут мы находим, где находится узел и отцепляем его от родителя
+      AddToAncestors(removing_node, -1, statistic_tag{});
       if (removing_node == removing_node->parent_->left_)
         removing_node->parent_->left_ = nullptr;
       else
@@ -641,6 +1747,7 @@ class RBTree {
     std::swap(removing_node->left_, tmp->left_);
     std::swap(removing_node->right_, tmp->right_);
     std::swap(removing_node->color_, tmp->color_);
+    SwapCount(removing_node, tmp, statistic_tag{});
 
     // замена родителей у свапаемых нод
     if (removing_node->right_) removing_node->right_->parent_ = removing_node;
@@ -668,13 +1775,11 @@ class RBTree {
         if (tmp->color_ == tRed) {
           std::swap(parent->color_, tmp->color_);
           LeftRotate(parent);
-          parent = checked_node->parent_;
           tmp = parent->right_;
         }
 
         // Случай второй
-        if (tmp->color_ == tBlack &&
-            (tmp->left_ == nullptr || tmp->left_->color_ == tBlack) &&
+        if ((tmp->left_ == nullptr || tmp->left_->color_ == tBlack) &&
             (tmp->right_ == nullptr || tmp->right_->color_ == tBlack)) {
           tmp->color_ = tRed;
           if (parent->color_ == tRed) {
@@ -683,12 +1788,11 @@ class RBTree {
           }
           // закончили с балансировкой, но нужно теперь заниматься балансировкой
           // родителя
-          tmp = parent;
-          parent = tmp->parent_;
+          checked_node = parent;
+          parent = checked_node->parent_;
         } else {
           // тут уже будут третий и четвертый случаи
-          if (tmp->left_ != nullptr && tmp->left_->color_ == tRed &&
-              (tmp->right_ == nullptr || tmp->right_->color_ == tBlack)) {
+          if (tmp->right_ == nullptr || tmp->right_->color_ == tBlack) {
             // собственно третий случай
             std::swap(tmp->color_, tmp->left_->color_);
             RightRotate(tmp);
@@ -698,25 +1802,23 @@ class RBTree {
           tmp->right_->color_ = tBlack;
           tmp->color_ = parent->color_;
           parent->color_ = tBlack;
-          RightRotate(parent);
+          LeftRotate(parent);
           // Закончили с балансировкой
           break;
         }
       } else {
         // ну и осталось рассмотреть случай когда у нас не слева от родителя, а
-        // справа
-        tree_node *tmp = parent->right_;
+        // справа(брат слева, все повороты зеркальные)
+        tree_node *tmp = parent->left_;
 
         // Первый случай
         if (tmp->color_ == tRed) {
           std::swap(tmp->color_, parent->color_);
           RightRotate(parent);
-          parent = checked_node->parent_;
           tmp = parent->left_;
         }
         // Второй случай
-        if (tmp->color_ == tBlack &&
-            (tmp->left_ == nullptr || tmp->left_->color_ == tBlack) &&
+        if ((tmp->left_ == nullptr || tmp->left_->color_ == tBlack) &&
             (tmp->right_ == nullptr || tmp->right_->color_ == tBlack)) {
           tmp->color_ = tRed;
           if (parent->color_ == tRed) {
@@ -725,16 +1827,15 @@ class RBTree {
           }
           // закончили с балансировкой, но нужно теперь заниматься балансировкой
           // родителя
-          tmp = parent;
-          parent = tmp->parent_;
+          checked_node = parent;
+          parent = checked_node->parent_;
         } else {
           // тут уже будут третий и четвертый случаи
-          if (tmp->right_ != nullptr && tmp->right_->color_ == tRed &&
-              (tmp->left_ == nullptr || tmp->left_->color_ == tBlack)) {
+          if (tmp->left_ == nullptr || tmp->left_->color_ == tBlack) {
             // собственно третий случай
             std::swap(tmp->color_, tmp->right_->color_);
             LeftRotate(tmp);
-            tmp = tmp->left_;
+            tmp = parent->left_;
           }
           // ну и последний случай
           tmp->left_->color_ = tBlack;
@@ -795,46 +1896,30 @@ class RBTree {
   }
 
   // создаем класс для реализации узла КЧ дерева
-  struct RedBlackNode {
-    // Конструктор по-умолчанию, для создания пустого узла
-    RedBlackNode()
-        : parent_(nullptr),
-          left_(this),
-          right_(this),
-          key_(key_type{}),
-          color_(tRed) {}
-
-    // Конструктор для создания узла со значением key
-    RedBlackNode(const key_type &key)
+  struct RedBlackNode : Statistic::NodeBase {
+    // Узел без ключа: ключ создает и разрушает само дерево через свой
+    // аллокатор(CreateNode и DestroyNode), у head_ ключа нет вовсе
+    RedBlackNode() noexcept
         : parent_(nullptr),
           left_(nullptr),
           right_(nullptr),
-          key_(key),
-          color_(tRed) {}
+          color_(tRed),
+          standalone_(false) {}
 
-    // Конструктор для создания узла со значением key используя move-семантику.
-    //  Для того чтобы понять что такое move-семантика можно прочитать данную
-    //  статью: https://tproger.ru/articles/move-semantics-and-rvalue/
-    RedBlackNode(key_type &&key)
-        : parent_(nullptr),
-          left_(nullptr),
-          right_(nullptr),
-          key_(std::move(key)),
-          color_(tRed) {}
-
-    // Конструктор для создания узла со значением key и цветом color
-    RedBlackNode(key_type key, tree_color color)
-        : parent_(nullptr),
-          left_(this),
-          right_(this),
-          key_(key),
-          color_(color) {}
+    ~RedBlackNode() {}
 
     void ToDefaultNode() noexcept {
       left_ = nullptr;
       right_ = nullptr;
       parent_ = nullptr;
       color_ = tRed;
+      this->ResetStatistic();
+    }
+
+    // Узел head_(он же end_()) - единственный красный узел без родителя или
+    // с родителем-корнем, который ссылается на него же
+    bool IsHead() const noexcept {
+      return color_ == tRed && (parent_ == nullptr || parent_->parent_ == this);
     }
 
     // Возвращает следующий за текущим узлом, узел
@@ -899,12 +1984,86 @@ class RBTree {
     tree_node *parent_;
     tree_node *left_;
     tree_node *right_;
-    key_type key_;
+    union {
+      key_type key_;
+    };
     tree_color color_;
+    // Узел - отдельное выделение у аллокатора, а не ячейка пула
+    // (CreateStandalone). ToDefaultNode его не сбрасывает
+    bool standalone_;
+  };
+  // Node handle: единолично владеет извлеченным узлом вне пула и копией
+  // аллокатора, которым узел освобождается. С деревом и его пулом не
+  // связан, поэтому может пережить дерево и уйти в другой поток. Пустой
+  // handle ничего не держит
+  class RedBlackNodeHandle {
+   public:
+    RedBlackNodeHandle() noexcept = default;
+
+    RedBlackNodeHandle(RedBlackNodeHandle &&other) noexcept
+        : node_(std::exchange(other.node_, nullptr)),
+          alloc_(std::move(other.alloc_)) {
+      other.alloc_.reset();
+    }
+
+    RedBlackNodeHandle &operator=(RedBlackNodeHandle &&other) noexcept {
+      if (this != &other) {
+        Reset();
+        node_ = std::exchange(other.node_, nullptr);
+        alloc_ = std::move(other.alloc_);
+        other.alloc_.reset();
+      }
+      return *this;
+    }
+
+    ~RedBlackNodeHandle() { Reset(); }
+
+    bool empty() const noexcept { return node_ == nullptr; }
+
+    explicit operator bool() const noexcept { return node_ != nullptr; }
+
+    // Значение узла(для множеств)
+    key_type &value() const noexcept { return node_->key_; }
+
+    // Ключ и значение узла словаря. Ключ можно изменить и вставить узел
+    // обратно без выделения памяти
+    template <typename V = key_type>
+    auto key() const noexcept -> decltype((std::declval<V &>().first)) {
+      return node_->key_.first;
+    }
+
+    template <typename V = key_type>
+    auto mapped() const noexcept -> decltype((std::declval<V &>().second)) {
+      return node_->key_.second;
+    }
+
+    void swap(RedBlackNodeHandle &other) noexcept {
+      std::swap(node_, other.node_);
+      alloc_.swap(other.alloc_);
+    }
+
+   private:
+    friend class RBTree;
+
+    RedBlackNodeHandle(tree_node *node, const allocator_type &alloc) noexcept
+        : node_(node), alloc_(alloc) {}
+
+    // Разрушает узел и возвращает его память аллокатору
+    void Reset() noexcept {
+      if (node_ != nullptr) {
+        RBTree::DestroyStandalone(*alloc_, node_);
+        node_ = nullptr;
+      }
+      alloc_.reset();
+    }
+
+    tree_node *node_ = nullptr;
+    std::optional<allocator_type> alloc_;
   };
+
   struct RedBlackIterator {
-    using iterator_category = std::forward_iterator_tag;
-    using dif_type = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
     using value_type = tree_type::key_type;
     using pointer = value_type *;
     using reference = value_type &;
@@ -917,7 +2076,10 @@ class RBTree {
     explicit RedBlackIterator(tree_node *node) : node_(node) {}
 
     // Получаем указатель на значение узла
-    reference operator*() const noexcept { return node_->key_; }
+    reference operator*() const noexcept(!kCheckedIterators) {
+      S21_ITERATOR_CHECK(!node_->IsHead(), "dereferencing end of tree");
+      return node_->key_;
+    }
 
     // префиксное обращение оператора к итератору к следующему элементу
     iterator &operator++() noexcept {
@@ -933,7 +2095,7 @@ class RBTree {
     }
 
     // префиксное обращение оператора к итератору к предыдущему элементу
-    iterator &operator--() const noexcept {
+    iterator &operator--() noexcept {
       node_ = node_->PrevNode();
       return *this;
     }
@@ -972,8 +2134,8 @@ class RBTree {
   //  4) node_ объявлено const
 
   struct RedBlackIteratorConst {
-    using iterator_category = std::forward_iterator_tag;
-    using dif_type = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
     using value_type = tree_type::key_type;
     using pointer = const value_type *;
     using reference = const value_type &;
@@ -982,7 +2144,13 @@ class RBTree {
 
     explicit RedBlackIteratorConst(const tree_node *node) : node_(node) {}
 
-    reference operator*() const noexcept { return node_->key_; }
+    // неявное преобразование из обычного итератора
+    RedBlackIteratorConst(const iterator &other) : node_(other.node_) {}
+
+    reference operator*() const noexcept(!kCheckedIterators) {
+      S21_ITERATOR_CHECK(!node_->IsHead(), "dereferencing end of tree");
+      return node_->key_;
+    }
 
     const_iterator &operator++() noexcept {
       node_ = node_->NodeNext();
@@ -1018,9 +2186,28 @@ class RBTree {
 
     const tree_node *node_;
   };
+  // Результат вставки node handle: позиция элемента, удалась ли вставка и
+  // сам узел, если не удалась
+  struct RedBlackInsertReturn {
+    iterator position;
+    bool inserted;
+    node_type node;
+  };
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using key_allocator = rebind_alloc_t<Allocator, key_type>;
+  using key_traits = std::allocator_traits<key_allocator>;
+  using head_allocator = rebind_alloc_t<Allocator, tree_node>;
+  using head_traits = std::allocator_traits<head_allocator>;
+
   tree_node *head_;
   size_type size_;
   Comparator cmp_;
+  // Сколько узлов дерева выделено вне пула(пришли из node handle)
+  size_type standalone_ = 0;
+  // Пул принадлежит только этому дереву: ни другие деревья, ни node handle
+  // его не держат, поэтому разные контейнеры независимы и между потоками
+  node_allocator alloc_;
 };
 }  // namespace s21
 
@@ -1,82 +1,221 @@
 #ifndef S21_CONTAINERS_S21_VECTOR_H_
 #define S21_CONTAINERS_S21_VECTOR_H_
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "iterators/s21_checked_iterator.h"
+#include "s21_allocator.h"
+
 namespace s21 {
+// Типы, объекты которых можно перенести в новую память через memcpy без
+// вызова деструктора у старых байт. Можно специализировать для типов, которые
+// не тривиально копируемы, но переносимы(например, аналог unique_ptr)
 template <typename T>
-class vector {
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+// Отсекает целые типы в перегрузках с парой итераторов(vector(5, 3) - это
+// пять троек, а не диапазон)
+template <typename InputIt>
+using iterator_category_t =
+    typename std::iterator_traits<InputIt>::iterator_category;
+
+// Политики роста емкости vector. Next(capacity, value_size) предлагает
+// новую емкость вместо заполненной capacity(вектор берет максимум из нее и
+// требуемого размера). kInPlaceRealloc разрешает тривиально переносимым
+// типам расти через realloc - без копирования, если блок удается
+// расширить(большие блоки glibc переносит через mremap)
+struct DoublingGrowth {
+  static constexpr bool kInPlaceRealloc = false;
+
+  static constexpr std::size_t Next(std::size_t capacity,
+                                    std::size_t) noexcept {
+    return capacity ? 2 * capacity : 1;
+  }
+};
+
+// Рост в 1.5 раза: сумма освобожденных при росте блоков со временем
+// превышает новый запрос, и аллокатор может их переиспользовать
+struct OneAndHalfGrowth {
+  static constexpr bool kInPlaceRealloc = false;
+
+  static constexpr std::size_t Next(std::size_t capacity,
+                                    std::size_t) noexcept {
+    return capacity < 2 ? capacity + 1 : capacity + capacity / 2;
+  }
+};
+
+// Для больших буферов: до страницы рост вдвое, дальше в 1.5 раза с
+// округлением размера до целых страниц и ростом на месте через realloc
+struct PageRoundedGrowth {
+  static constexpr bool kInPlaceRealloc = true;
+  static constexpr std::size_t kPageSize = 4096;
+
+  static constexpr std::size_t Next(std::size_t capacity,
+                                    std::size_t value_size) noexcept {
+    if (capacity * value_size < kPageSize) return capacity ? 2 * capacity : 1;
+    std::size_t grown = capacity + capacity / 2;
+    if (grown > (std::numeric_limits<std::size_t>::max() - kPageSize) /
+                    value_size)
+      return grown;
+    std::size_t bytes = (grown * value_size + kPageSize - 1) / kPageSize;
+    return bytes * kPageSize / value_size;
+  }
+};
+
+// Allocator - откуда берется память под элементы(через
+// std::allocator_traits). realloc используется только со std::allocator
+template <typename T, typename Growth = DoublingGrowth,
+          typename Allocator = std::allocator<T>>
+class vector : private AllocatorStorage<Allocator> {
+  using storage = AllocatorStorage<Allocator>;
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  static_assert(std::is_same_v<typename Allocator::value_type, T>,
+                "vector::allocator_type::value_type must be T");
+  static_assert(std::is_same_v<typename alloc_traits::pointer, T *>,
+                "vector supports only allocators with raw pointers");
+
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+#ifdef S21_CHECKED_ITERATORS
+  using iterator = CheckedIterator<T, vector>;
+  using const_iterator = CheckedIterator<const T, vector>;
+#else
   using iterator = T *;
   using const_iterator = const T *;
+#endif
   using size_type = std::size_t;
   using difference_type = std::ptrdiff_t;
 
  public:
   vector() = default;
 
-  explicit vector(size_type size) {
-    size_ = size;
-    capacity_ = size;
-    buffer_ = nullptr;
-    if (size > 0) {
-      buffer_ = new value_type[capacity_];
+  explicit vector(const allocator_type &alloc) noexcept : storage(alloc) {}
+
+  explicit vector(size_type size,
+                  const allocator_type &alloc = allocator_type())
+      : storage(alloc), capacity_(size), buffer_(allocate(size)) {
+    try {
+      uninitializedValue(buffer_, size);
+    } catch (...) {
+      deallocate(buffer_, size);
+      throw;
     }
+    size_ = size;
+  }
+
+  vector(size_type count, const_reference value,
+         const allocator_type &alloc = allocator_type())
+      : storage(alloc) {
+    appendCopies(count, value);
   }
 
-  vector(std::initializer_list<value_type> const &init)
-      : size_{init.size()},
+  template <typename InputIt, typename = iterator_category_t<InputIt>>
+  vector(InputIt first, InputIt last,
+         const allocator_type &alloc = allocator_type())
+      : storage(alloc) {
+    insertRange(0, first, last);
+  }
+
+  vector(std::initializer_list<value_type> const &init,
+         const allocator_type &alloc = allocator_type())
+      : storage(alloc),
         capacity_(init.size()),
-        buffer_{new value_type[capacity_]} {
-    std::copy(init.begin(), init.end(), buffer_);
+        buffer_(allocate(init.size())) {
+    try {
+      uninitializedCopy(init.begin(), init.end(), buffer_);
+    } catch (...) {
+      deallocate(buffer_, init.size());
+      throw;
+    }
+    size_ = init.size();
   }
 
-  vector(const vector &cpy) {
-    size_ = cpy.size_;
-    capacity_ = cpy.capacity_;
-    buffer_ = nullptr;
-    if (size_ > 0) {
-      buffer_ = new value_type[capacity_];
+  // Копия получает аллокатор от select_on_container_copy_construction
+  vector(const vector &cpy)
+      : vector(cpy, alloc_traits::select_on_container_copy_construction(
+                        cpy.allocator())) {}
+
+  vector(const vector &cpy, const allocator_type &alloc)
+      : storage(alloc), capacity_(cpy.size_), buffer_(allocate(cpy.size_)) {
+    try {
+      uninitializedCopy(cpy.buffer_, cpy.buffer_ + cpy.size_, buffer_);
+    } catch (...) {
+      deallocate(buffer_, cpy.size_);
+      throw;
     }
-    std::copy(cpy.begin(), cpy.end(), buffer_);
+    size_ = cpy.size_;
   }
 
-  vector(vector &&mcv) noexcept {
-    size_ = std::exchange(mcv.size_, 0);
-    capacity_ = std::exchange(mcv.capacity_, 0);
-    buffer_ = std::exchange(mcv.buffer_, 0);
+  vector(vector &&mcv) noexcept : storage(mcv.allocator()) {
+    swapBuffers(mcv);
   }
 
-  ~vector() { delete[] buffer_; }
+  // Буфер забирается, только если alloc может его освободить, иначе
+  // элементы перемещаются поштучно в новую память
+  vector(vector &&mcv, const allocator_type &alloc) : storage(alloc) {
+    if (alloc == mcv.allocator()) {
+      swapBuffers(mcv);
+    } else {
+      insertRange(0, std::make_move_iterator(mcv.buffer_),
+                  std::make_move_iterator(mcv.buffer_ + mcv.size_));
+    }
+  }
 
-  vector &operator=(vector &&mcv) noexcept {
-    if (this != &mcv) {
-      size_ = std::exchange(mcv.size_, 0);
-      capacity_ = std::exchange(mcv.capacity_, 0);
-      buffer_ = std::exchange(mcv.buffer_, 0);
+  ~vector() {
+    destroyRange(buffer_, buffer_ + size_);
+    deallocate(buffer_, capacity_);
+  }
+
+  // Аллокатор переходит к *this, только если этого требует
+  // propagate_on_container_move_assignment. Иначе при неравных аллокаторах
+  // элементы перемещаются поштучно
+  vector &operator=(vector &&mcv) noexcept(kMoveStealsMemory<Allocator>) {
+    if (this == &mcv) return *this;
+    if constexpr (kMoveStealsMemory<Allocator>) {
+      stealBuffer(mcv);
+    } else if (allocator() == mcv.allocator()) {
+      stealBuffer(mcv);
+    } else {
+      assign(std::make_move_iterator(mcv.buffer_),
+             std::make_move_iterator(mcv.buffer_ + mcv.size_));
+      mcv.clear();
     }
     return *this;
   }
 
   vector &operator=(const vector &mcv) {
     if (this != &mcv) {
-      delete[] buffer_;
-      if (mcv.size_ > 0) {
-        buffer_ = new value_type[mcv.capacity_];
-        std::copy(mcv.begin(), mcv.end(), buffer_);
+      constexpr bool propagate =
+          alloc_traits::propagate_on_container_copy_assignment::value;
+      vector tmp(mcv, propagate ? mcv.allocator() : allocator());
+      swapBuffers(tmp);
+      if constexpr (propagate) {
+        using std::swap;
+        swap(allocator(), tmp.allocator());
       }
-      size_ = mcv.size;
-      capacity_ = mcv.capacity;
     }
     return *this;
   }
 
+  allocator_type get_allocator() const noexcept { return allocator(); }
+
  public:
   reference at(size_type ind) {
     if (ind >= size_) {
@@ -85,19 +224,28 @@ class vector {
     return buffer_[ind];
   }
   const_reference at(size_type ind) const {
-    if (ind > size_) {
+    if (ind >= size_) {
       throw std::logic_error("vector::The index is out of range");
     }
     return buffer_[ind];
   }
 
-  constexpr reference operator[](size_type ind) { return at(ind); }
+  // Без проверки границ(кроме режима S21_CHECKED_ITERATORS)
+  constexpr reference operator[](size_type ind) {
+    S21_ITERATOR_CHECK(ind < size_, "vector::The index is out of range");
+    return buffer_[ind];
+  }
 
-  constexpr const_reference operator[](size_type ind) const { return at(ind); }
+  constexpr const_reference operator[](size_type ind) const {
+    S21_ITERATOR_CHECK(ind < size_, "vector::The index is out of range");
+    return buffer_[ind];
+  }
 
-  constexpr iterator begin() noexcept { return buffer_; }
+  constexpr iterator begin() noexcept { return makeIterator(buffer_); }
 
-  constexpr const_iterator begin() const noexcept { return buffer_; }
+  constexpr const_iterator begin() const noexcept {
+    return makeIterator(buffer_);
+  }
 
   constexpr reference front() {
     if (size_ == 0) throw std::logic_error("zero sized container used");
@@ -109,9 +257,11 @@ class vector {
     return *begin();
   }
 
-  constexpr iterator end() noexcept { return buffer_ + size_; }
+  constexpr iterator end() noexcept { return makeIterator(buffer_ + size_); }
 
-  constexpr const_iterator end() const noexcept { return buffer_ + size_; }
+  constexpr const_iterator end() const noexcept {
+    return makeIterator(buffer_ + size_);
+  }
 
   constexpr reference back() {
     if (size_ == 0) throw std::logic_error("Methods on a zero");
@@ -123,28 +273,36 @@ class vector {
     return *std::prev(end());
   }
 
-  constexpr iterator data() noexcept { return buffer_; }
+  constexpr pointer data() noexcept { return buffer_; }
 
-  constexpr const_iterator data() const noexcept { return buffer_; }
+  constexpr const_pointer data() const noexcept { return buffer_; }
 
  public:
-  [[nodiscard]] bool empty() const noexcept { return begin() == end(); }
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
 
-  [[nodiscard]] constexpr size_type size() const noexcept {
-    return std::distance(begin(), end());
-  }
+  [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
 
   [[nodiscard]] constexpr size_type max_size() const noexcept {
     return std::numeric_limits<size_type>::max() / sizeof(size_type) / 2;
   }
 
-  constexpr void reverse(size_type capacity) {
+  // Емкость не меньше capacity. Рост идет по политике Growth, поэтому
+  // повторные reserve(size() + k) не превращаются в квадратичное время
+  constexpr void reserve(size_type capacity) {
+    if (capacity <= capacity_) {
+      return;
+    }
+    reallocVector(grownCapacity(capacity));
+  }
+
+  // Емкость ровно capacity(если она больше текущей)
+  constexpr void reserve_exact(size_type capacity) {
     if (capacity <= capacity_) {
       return;
     }
     if (capacity > max_size()) {
-      throw std::logic_error(
-          "reverse capacity is more then max_size value_type");
+      throw std::length_error(
+          "reserve capacity is more then max_size value_type");
     }
     reallocVector(capacity);
   }
@@ -159,122 +317,650 @@ class vector {
   }
 
   constexpr iterator insert(const_iterator ind, value_type &&val) {
-    size_type position = ind - begin();
-    if (position > size_) {
-      throw std::out_of_range("Position is out of range of begin to end");
-    }
-    if (size_ == capacity_) {
-      if (size_)
-        reallocVector(2 * size_);
-      else
-        reallocVector(size_);
-    }
-    std::copy(begin() + position, end(), begin() + position + 1);
-    *(buffer_ + position) = std::move(val);
-    ++size_;
-    return begin() + position;
+    return emplaceAt(checkedPosition(ind), std::move(val));
   }
 
   constexpr iterator insert(const_iterator ind, const_reference val) {
-    size_type position = ind - begin();
-    if (position > size_) {
-      throw std::out_of_range("Position is out of range of begin to end");
-    }
-    if (size_ == capacity_) {
-      if (size_)
-        reallocVector(2 * size_);
-      else
-        reallocVector(size_);
+    return emplaceAt(checkedPosition(ind), val);
+  }
+
+  // Вставка count копий value: емкость растет не более одного раза, хвост
+  // сдвигается один раз
+  constexpr iterator insert(const_iterator ind, size_type count,
+                            const_reference value) {
+    // value может лежать в самом векторе, а сдвиг хвоста его затронет
+    if (ownsElement(&value)) {
+      value_type copy(value);
+      return insert(ind, count, copy);
     }
-    std::copy(begin() + position, end(), begin() + position + 1);
-    *(buffer_ + position) = std::move(val);
-    ++size_;
-    return begin() + position;
+    return insertWith(checkedPosition(ind), count,
+                      [this, &value, count](pointer dest) {
+                        uninitializedFill(dest, count, value);
+                      });
+  }
+
+  // Вставка диапазона [first, last), который не должен указывать в *this
+  template <typename InputIt, typename = iterator_category_t<InputIt>>
+  constexpr iterator insert(const_iterator ind, InputIt first, InputIt last) {
+    return insertRange(checkedPosition(ind), first, last);
+  }
+
+  constexpr iterator insert(const_iterator ind,
+                            std::initializer_list<value_type> items) {
+    return insertRange(checkedPosition(ind), items.begin(), items.end());
+  }
+
+  // Вставка в конец всех элементов range(контейнер или массив)
+  template <typename Range>
+  constexpr void append_range(Range &&range) {
+    insertRange(size_, std::begin(range), std::end(range));
   }
 
   constexpr iterator erase(const_iterator ind) {
-    size_type position = ind - begin();
+    size_type position = checkedPosition(ind);
 
-    if (position > size_) {
+    if (position >= size_) {
       throw std::out_of_range("Position is out of range of begin to end");
     }
 
-    std::copy(begin(), const_cast<iterator>(ind), buffer_);
-    std::copy(const_cast<iterator>(ind) + 1, end(), buffer_ + position);
+    eraseRange(position, 1);
+    return begin() + position;
+  }
 
-    --size_;
+  constexpr iterator erase(const_iterator first, const_iterator last) {
+    size_type position = checkedPosition(first);
+    size_type end_position = checkedPosition(last);
+
+    if (position > end_position) {
+      throw std::out_of_range("Range end is before range begin");
+    }
+
+    eraseRange(position, end_position - position);
     return begin() + position;
   }
 
-  constexpr void push_back(const_reference val) {
-    if (size_ == capacity_) {
-      if (size_)
-        reverse(size_ * 2);
-      else
-        reverse(size_);
+  // Заменяет содержимое на count копий value. Существующие элементы
+  // переприсваиваются, память выделяется только при нехватке емкости
+  constexpr void assign(size_type count, const_reference value) {
+    if (count > capacity_) {
+      vector tmp(count, value, allocator());
+      swap(tmp);
+      return;
     }
-    buffer_[size_] = val;
-    ++size_;
+    std::fill_n(buffer_, std::min(count, size_), value);
+    if (count > size_) {
+      appendCopies(count - size_, value);
+    } else {
+      eraseRange(count, size_ - count);
+    }
+    invalidateIterators();
   }
 
-  constexpr void push_back(value_type &&val) {
-    if (size_ == capacity_) {
-      if (size_)
-        reverse(size_ * 2);
-      else
-        reverse(size_);
+  template <typename InputIt, typename = iterator_category_t<InputIt>>
+  constexpr void assign(InputIt first, InputIt last) {
+    using category = iterator_category_t<InputIt>;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      size_type count = std::distance(first, last);
+      if (count > capacity_) {
+        vector tmp(first, last, allocator());
+        swap(tmp);
+        return;
+      }
+      InputIt mid = first;
+      std::advance(mid, std::min(count, size_));
+      std::copy(first, mid, buffer_);
+      if (count > size_) {
+        insertRange(size_, mid, last);
+      } else {
+        eraseRange(count, size_ - count);
+      }
+    } else {
+      clear();
+      insertRange(0, first, last);
     }
-    buffer_[size_] = std::move(val);
-    ++size_;
+    invalidateIterators();
+  }
+
+  constexpr void assign(std::initializer_list<value_type> items) {
+    assign(items.begin(), items.end());
+  }
+
+  // Новые элементы создаются по умолчанию(value-initialization)
+  constexpr void resize(size_type count) {
+    if (count <= size_) {
+      eraseRange(count, size_ - count);
+      return;
+    }
+    size_type extra = count - size_;
+    insertWith(size_, extra, [this, extra](pointer dest) {
+      uninitializedValue(dest, extra);
+    });
   }
 
+  constexpr void resize(size_type count, const_reference value) {
+    if (count <= size_) {
+      eraseRange(count, size_ - count);
+      return;
+    }
+    appendCopies(count - size_, value);
+  }
+
+  constexpr void push_back(const_reference val) { emplaceBack(val); }
+
+  constexpr void push_back(value_type &&val) { emplaceBack(std::move(val)); }
+
   constexpr void pop_back() {
     if (size_ == 0) {
       throw std::logic_error("Vector is null, size = 0");
     }
+    destroyAt(buffer_ + size_ - 1);
     --size_;
   }
 
+  // Аллокаторы обмениваются, только если этого требует
+  // propagate_on_container_swap(иначе они должны быть равны)
   constexpr void swap(vector &other) noexcept {
-    std::swap(buffer_, other.buffer_);
-    std::swap(size_, other.size_);
-    std::swap(capacity_, other.capacity_);
+    swapBuffers(other);
+    PropagateOnSwap(allocator(), other.allocator());
   }
 
+  // Элемент создается прямо в буфере из аргументов конструктора args
   template <typename... Args>
   constexpr iterator emplace(const_iterator ind, Args &&...args) {
-    iterator iter = nullptr;
-    auto id = ind - begin();
-    reverse(capacity_ + sizeof...(args));
+    return emplaceAt(checkedPosition(ind), std::forward<Args>(args)...);
+  }
 
-    for (auto &&item : {std::forward<Args>(args)...}) {
-      iter = insert(begin() + id, item);
-    }
-    return iter;
+  template <typename... Args>
+  constexpr reference emplace_back(Args &&...args) {
+    return *emplaceBack(std::forward<Args>(args)...);
   }
 
+  // Каждый из args вставляется отдельным элементом начиная с ind,
+  // возвращается итератор на последний вставленный(или ind, если args пуст)
   template <typename... Args>
-  constexpr iterator emplace_back(Args &&...args) {
-    for (auto &&item : {std::forward<Args>(args)...}) {
-      push_back(item);
-    }
-    return end() - 1;
+  constexpr iterator insert_many(const_iterator ind, Args &&...args) {
+    size_type position = checkedPosition(ind);
+    (emplaceAt(position++, std::forward<Args>(args)), ...);
+    return begin() + position - (sizeof...(args) == 0 ? 0 : 1);
   }
 
-  constexpr void clear() noexcept { size_ = 0; }
+  template <typename... Args>
+  constexpr void insert_many_back(Args &&...args) {
+    (emplaceBack(std::forward<Args>(args)), ...);
+  }
+
+  constexpr void clear() noexcept {
+    destroyRange(buffer_, buffer_ + size_);
+    size_ = 0;
+  }
 
  private:
+  using storage::allocator;
+
   size_type size_ = 0;
   size_type capacity_ = 0;
-  iterator buffer_ = nullptr;
+  pointer buffer_ = nullptr;
+#ifdef S21_CHECKED_ITERATORS
+  // Растет, когда итераторы становятся недействительными
+  size_type version_ = 0;
+
+  friend iterator;
+  friend const_iterator;
+#endif
+
+  static constexpr bool kOverAligned =
+      alignof(value_type) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+  // Аллокатор по умолчанию: элементы создаются как в стандартных
+  // алгоритмах std::uninitialized_*
+  static constexpr bool kDefaultAllocator =
+      std::is_same_v<Allocator, std::allocator<value_type>>;
+
+  // Память берется через malloc, чтобы ее можно было расширять realloc.
+  // Чужой аллокатор(например арена std::pmr) этого не умеет
+  static constexpr bool kUseRealloc =
+      Growth::kInPlaceRealloc && kDefaultAllocator && !kOverAligned &&
+      is_trivially_relocatable<value_type>::value;
+
+  // Сырая память под count элементов, ничего не конструируется
+  pointer allocate(size_type count) {
+    if (count == 0) return nullptr;
+    if (count > std::numeric_limits<size_type>::max() / sizeof(value_type))
+      throw std::length_error("vector::allocation size is too big");
+    if constexpr (kUseRealloc) {
+      void *memory = std::malloc(count * sizeof(value_type));
+      if (memory == nullptr) throw std::bad_alloc();
+      return static_cast<pointer>(memory);
+    } else {
+      return alloc_traits::allocate(allocator(), count);
+    }
+  }
+
+  // count - размер, с которым буфер был выделен
+  void deallocate(pointer buffer, size_type count) noexcept {
+    if (buffer == nullptr) return;
+    if constexpr (kUseRealloc) {
+      std::free(buffer);
+    } else {
+      alloc_traits::deallocate(allocator(), buffer, count);
+    }
+  }
+
+  // Элементы создаются и разрушаются только через аллокатор(аллокатор
+  // std::pmr передает свой ресурс элементам, которые его принимают)
+  template <typename... Args>
+  void constructAt(pointer ptr, Args &&...args) {
+    alloc_traits::construct(allocator(), ptr, std::forward<Args>(args)...);
+  }
+
+  void destroyAt(pointer ptr) noexcept {
+    alloc_traits::destroy(allocator(), ptr);
+  }
+
+  void destroyRange(pointer first, pointer last) noexcept {
+    for (; first != last; ++first) destroyAt(first);
+  }
+
+  // Аналоги std::uninitialized_*: при исключении уже созданные элементы
+  // разрушаются
+  template <typename InputIt>
+  void uninitializedCopy(InputIt first, InputIt last, pointer dest) {
+    if constexpr (kDefaultAllocator) {
+      std::uninitialized_copy(first, last, dest);
+    } else {
+      pointer cur = dest;
+      try {
+        for (; first != last; ++first, ++cur) constructAt(cur, *first);
+      } catch (...) {
+        destroyRange(dest, cur);
+        throw;
+      }
+    }
+  }
+
+  void uninitializedFill(pointer dest, size_type count,
+                         const_reference value) {
+    if constexpr (kDefaultAllocator) {
+      std::uninitialized_fill_n(dest, count, value);
+    } else {
+      size_type done = 0;
+      try {
+        for (; done < count; ++done) constructAt(dest + done, value);
+      } catch (...) {
+        destroyRange(dest, dest + done);
+        throw;
+      }
+    }
+  }
+
+  void uninitializedValue(pointer dest, size_type count) {
+    if constexpr (kDefaultAllocator) {
+      std::uninitialized_value_construct_n(dest, count);
+    } else {
+      size_type done = 0;
+      try {
+        for (; done < count; ++done) constructAt(dest + done);
+      } catch (...) {
+        destroyRange(dest, dest + done);
+        throw;
+      }
+    }
+  }
+
+  // Временный элемент, созданный через аллокатор вектора, как и остальные
+  // элементы
+  class TemporaryValue {
+   public:
+    template <typename... Args>
+    explicit TemporaryValue(vector &owner, Args &&...args) : owner_(owner) {
+      owner_.constructAt(ptr(), std::forward<Args>(args)...);
+    }
+
+    TemporaryValue(const TemporaryValue &) = delete;
+    TemporaryValue &operator=(const TemporaryValue &) = delete;
+
+    ~TemporaryValue() { owner_.destroyAt(ptr()); }
+
+    reference value() noexcept { return *ptr(); }
+
+   private:
+    pointer ptr() noexcept {
+      return std::launder(reinterpret_cast<pointer>(storage_));
+    }
+
+    vector &owner_;
+    alignas(value_type) unsigned char storage_[sizeof(value_type)];
+  };
+
+  // Обмен содержимым без аллокаторов
+  void swapBuffers(vector &other) noexcept {
+    std::swap(buffer_, other.buffer_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    invalidateIterators();
+    other.invalidateIterators();
+  }
+
+  // Перемещающее присваивание, когда буфер mcv можно забрать целиком
+  void stealBuffer(vector &mcv) noexcept {
+    vector tmp(std::move(mcv));
+    swapBuffers(tmp);
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                      value) {
+      using std::swap;
+      swap(allocator(), tmp.allocator());
+    }
+  }
+
+  size_type IteratorVersion() const noexcept {
+#ifdef S21_CHECKED_ITERATORS
+    return version_;
+#else
+    return 0;
+#endif
+  }
+
+  void invalidateIterators() noexcept {
+#ifdef S21_CHECKED_ITERATORS
+    ++version_;
+#endif
+  }
+
+  iterator makeIterator(pointer ptr) noexcept {
+#ifdef S21_CHECKED_ITERATORS
+    return iterator(ptr, this);
+#else
+    return ptr;
+#endif
+  }
+
+  const_iterator makeIterator(const_pointer ptr) const noexcept {
+#ifdef S21_CHECKED_ITERATORS
+    return const_iterator(ptr, this);
+#else
+    return ptr;
+#endif
+  }
+
+  size_type checkedPosition(const_iterator ind) const {
+    size_type position = ind - begin();
+    if (position > size_) {
+      throw std::out_of_range("Position is out of range of begin to end");
+    }
+    return position;
+  }
+
+  // Емкость после роста для required элементов по политике Growth
+  size_type grownCapacity(size_type required) const {
+    if (required > max_size())
+      throw std::length_error("vector::capacity is more then max_size");
+    size_type proposed = Growth::Next(capacity_, sizeof(value_type));
+    return std::min(std::max(proposed, required), max_size());
+  }
+
+  // Расширение буфера через realloc: блок растет на месте или переносится
+  // побайтно самой библиотекой(только при kUseRealloc)
+  void reallocInPlace(size_type capacity) {
+    if (capacity > std::numeric_limits<size_type>::max() / sizeof(value_type))
+      throw std::length_error("vector::allocation size is too big");
+    void *memory = std::realloc(static_cast<void *>(buffer_),
+                                capacity * sizeof(value_type));
+    if (memory == nullptr) throw std::bad_alloc();
+    buffer_ = static_cast<pointer>(memory);
+    capacity_ = capacity;
+    invalidateIterators();
+  }
+
+  bool ownsElement(const_pointer ptr) const noexcept {
+    std::less<const_pointer> less;
+    return !less(ptr, buffer_) && less(ptr, buffer_ + size_);
+  }
+
+  // Хвост можно сдвинуть на месте, не опасаясь исключения посередине
+  static constexpr bool kNothrowShift =
+      is_trivially_relocatable<value_type>::value ||
+      std::is_nothrow_move_constructible_v<value_type>;
+
+  // Сдвигает хвост [position, size_) на count позиций вправо, оставляя на
+  // месте position сырую память. Емкости должно хватать
+  void openGap(size_type position, size_type count) noexcept {
+    if constexpr (is_trivially_relocatable<value_type>::value) {
+      std::memmove(static_cast<void *>(buffer_ + position + count),
+                   static_cast<const void *>(buffer_ + position),
+                   (size_ - position) * sizeof(value_type));
+    } else {
+      for (size_type i = size_; i-- > position;) {
+        constructAt(buffer_ + i + count, std::move(buffer_[i]));
+        destroyAt(buffer_ + i);
+      }
+    }
+  }
+
+  // Обратная операция к openGap(при исключении во время заполнения)
+  void closeGap(size_type position, size_type count) noexcept {
+    if constexpr (is_trivially_relocatable<value_type>::value) {
+      std::memmove(static_cast<void *>(buffer_ + position),
+                   static_cast<const void *>(buffer_ + position + count),
+                   (size_ - position) * sizeof(value_type));
+    } else {
+      for (size_type i = position; i < size_; ++i) {
+        constructAt(buffer_ + i, std::move(buffer_[i + count]));
+        destroyAt(buffer_ + i + count);
+      }
+    }
+  }
+
+  // Вставляет count элементов на место position: fill(dest) создает их в
+  // сырой памяти dest и не должен читать элементы самого вектора. Если
+  // емкости хватает - хвост сдвигается один раз, иначе емкость растет один
+  // раз(через realloc или в новый буфер)
+  template <typename Fill>
+  iterator insertWith(size_type position, size_type count, Fill fill) {
+    if (count == 0) return begin() + position;
+    if (count > max_size() - size_)
+      throw std::length_error("vector::insert size is too big");
+    if constexpr (kUseRealloc) {
+      if (size_ + count > capacity_)
+        reallocInPlace(grownCapacity(size_ + count));
+    }
+    if (size_ + count <= capacity_ && kNothrowShift) {
+      openGap(position, count);
+      try {
+        fill(buffer_ + position);
+      } catch (...) {
+        closeGap(position, count);
+        throw;
+      }
+    } else {
+      size_type capacity = grownCapacity(size_ + count);
+      pointer temp = allocate(capacity);
+      try {
+        fill(temp + position);
+      } catch (...) {
+        deallocate(temp, capacity);
+        throw;
+      }
+      try {
+        relocate(temp, position, count);
+      } catch (...) {
+        destroyRange(temp + position, temp + position + count);
+        deallocate(temp, capacity);
+        throw;
+      }
+      deallocate(buffer_, capacity_);
+      buffer_ = temp;
+      capacity_ = capacity;
+    }
+    size_ += count;
+    invalidateIterators();
+    return begin() + position;
+  }
+
+  // Диапазон с известной длиной вставляется одним insertWith, однопроходный
+  // - дописывается в конец и поворачивается на место
+  template <typename InputIt>
+  iterator insertRange(size_type position, InputIt first, InputIt last) {
+    using category = iterator_category_t<InputIt>;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      return insertWith(position, std::distance(first, last),
+                        [this, &first, &last](pointer dest) {
+                          uninitializedCopy(first, last, dest);
+                        });
+    } else {
+      size_type old_size = size_;
+      for (; first != last; ++first) emplaceBack(*first);
+      std::rotate(buffer_ + position, buffer_ + old_size, buffer_ + size_);
+      invalidateIterators();
+      return begin() + position;
+    }
+  }
+
+  void appendCopies(size_type count, const_reference value) {
+    if (ownsElement(&value)) {
+      value_type copy(value);
+      appendCopies(count, copy);
+      return;
+    }
+    insertWith(size_, count, [this, &value, count](pointer dest) {
+      uninitializedFill(dest, count, value);
+    });
+  }
+
+  // Удаляет count элементов начиная с position одним сдвигом хвоста
+  void eraseRange(size_type position, size_type count) noexcept(
+      is_trivially_relocatable<value_type>::value ||
+      std::is_nothrow_move_assignable_v<value_type>) {
+    if (count == 0) return;
+    if constexpr (is_trivially_relocatable<value_type>::value) {
+      destroyRange(buffer_ + position, buffer_ + position + count);
+      std::memmove(static_cast<void *>(buffer_ + position),
+                   static_cast<const void *>(buffer_ + position + count),
+                   (size_ - position - count) * sizeof(value_type));
+    } else {
+      std::move(buffer_ + position + count, buffer_ + size_,
+                buffer_ + position);
+      destroyRange(buffer_ + size_ - count, buffer_ + size_);
+    }
+    size_ -= count;
+    invalidateIterators();
+  }
+
+  // Переносит элементы в new_buffer, оставляя gap пустых ячеек на месте
+  // position. Переносимые типы копируются побайтно, остальные перемещаются,
+  // если перемещение не бросает исключений, иначе копируются - тогда при
+  // исключении *this не меняется
+  void relocate(pointer new_buffer, size_type position, size_type gap) {
+    if constexpr (is_trivially_relocatable<value_type>::value) {
+      if (size_ == 0) return;
+      std::memcpy(static_cast<void *>(new_buffer),
+                  static_cast<const void *>(buffer_),
+                  position * sizeof(value_type));
+      std::memcpy(static_cast<void *>(new_buffer + position + gap),
+                  static_cast<const void *>(buffer_ + position),
+                  (size_ - position) * sizeof(value_type));
+    } else {
+      size_type done = 0;
+      try {
+        for (; done < position; ++done)
+          constructAt(new_buffer + done, std::move_if_noexcept(buffer_[done]));
+        for (; done < size_; ++done)
+          constructAt(new_buffer + done + gap,
+                      std::move_if_noexcept(buffer_[done]));
+      } catch (...) {
+        destroyRange(new_buffer, new_buffer + std::min(done, position));
+        if (done > position)
+          destroyRange(new_buffer + position + gap, new_buffer + done + gap);
+        throw;
+      }
+      destroyRange(buffer_, buffer_ + size_);
+    }
+  }
 
   void reallocVector(size_type capacity) {
-    auto temp = new value_type[capacity];
-    for (size_type i = 0; i < size_; ++i) temp[i] = std::move(buffer_[i]);
-    delete[] buffer_;
+    if constexpr (kUseRealloc) {
+      if (capacity != 0) return reallocInPlace(capacity);
+    }
+    pointer temp = allocate(capacity);
+    try {
+      relocate(temp, size_, 0);
+    } catch (...) {
+      deallocate(temp, capacity);
+      throw;
+    }
+    deallocate(buffer_, capacity_);
     buffer_ = temp;
     capacity_ = capacity;
+    invalidateIterators();
+  }
+
+  // Создает элемент из args на месте position, сдвигая хвост. args могут
+  // ссылаться на элементы самого вектора
+  template <typename... Args>
+  iterator emplaceAt(size_type position, Args &&...args) {
+    if (size_ == capacity_)
+      return growAndEmplace(position, std::forward<Args>(args)...);
+    if (position == size_) return emplaceBack(std::forward<Args>(args)...);
+    TemporaryValue tmp(*this, std::forward<Args>(args)...);
+    pointer last = buffer_ + size_;
+    constructAt(last, std::move(*(last - 1)));
+    std::move_backward(buffer_ + position, last - 1, last);
+    buffer_[position] = std::move(tmp.value());
+    ++size_;
+    invalidateIterators();
+    return begin() + position;
+  }
+
+  // Вставка в конец не требует присваивания от value_type
+  template <typename... Args>
+  iterator emplaceBack(Args &&...args) {
+    if (size_ == capacity_)
+      return growAndEmplace(size_, std::forward<Args>(args)...);
+    constructAt(buffer_ + size_, std::forward<Args>(args)...);
+    ++size_;
+    return end() - 1;
+  }
+
+  // Новый элемент создается в новой памяти до переноса старых, поэтому args
+  // остаются действительными, даже если ссылаются на элементы вектора
+  template <typename... Args>
+  iterator growAndEmplace(size_type position, Args &&...args) {
+    size_type capacity = grownCapacity(size_ + 1);
+    if constexpr (kUseRealloc) {
+      // args могут ссылаться на старый буфер, который realloc освободит
+      value_type tmp(std::forward<Args>(args)...);
+      reallocInPlace(capacity);
+      openGap(position, 1);
+      constructAt(buffer_ + position, std::move(tmp));
+      ++size_;
+      return begin() + position;
+    }
+    pointer temp = allocate(capacity);
+    try {
+      constructAt(temp + position, std::forward<Args>(args)...);
+    } catch (...) {
+      deallocate(temp, capacity);
+      throw;
+    }
+    try {
+      relocate(temp, position, 1);
+    } catch (...) {
+      destroyAt(temp + position);
+      deallocate(temp, capacity);
+      throw;
+    }
+    deallocate(buffer_, capacity_);
+    buffer_ = temp;
+    capacity_ = capacity;
+    ++size_;
+    invalidateIterators();
+    return begin() + position;
   }
 };
+
+namespace pmr {
+// vector, память которого берется из std::pmr::memory_resource
+template <typename T, typename Growth = DoublingGrowth>
+using vector = s21::vector<T, Growth, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 }  // namespace s21
 #endif  // S21_CONTAINERS_S21_VECTOR_H_
\ No newline at end of file
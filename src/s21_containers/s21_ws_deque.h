@@ -0,0 +1,185 @@
+#ifndef S21_CONTAINERS_S21_WS_DEQUE_H_
+#define S21_CONTAINERS_S21_WS_DEQUE_H_
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_cache_line.h"
+
+namespace s21 {
+// Дек для перехвата работы(алгоритм Chase-Lev). Поток-владелец кладет и
+// забирает задачи с нижнего конца, как у s21::stack, остальные потоки
+// крадут самые старые задачи с верхнего конца, как у s21::queue.
+// Владелец работает без атомарных RMW: push - только release-запись
+// bottom_, pop - запись и чтение в едином порядке seq_cst. CAS по top_
+// нужен ворам и владельцу лишь за последний элемент.
+//
+// Элементы - кольцо атомарных ячеек, которое растет вдвое при заполнении.
+// Старое кольцо может еще читать вор, поэтому оно не освобождается до
+// уничтожения дека. Все такие кольца вместе меньше текущего.
+// Ячейки читаются одновременно с записью, поэтому T - тривиально
+// копируемый тип без блокировок в std::atomic: указатель на задачу,
+// индекс и т.п.
+template <typename T>
+class ws_deque {
+  static_assert(std::is_trivially_copyable_v<T> &&
+                    std::atomic<T>::is_always_lock_free,
+                "ws_deque::T must be a lock-free trivially copyable type");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  // capacity округляется вверх до степени двойки. length_error, если
+  // capacity больше max_size()
+  explicit ws_deque(size_type capacity = kMinCapacity);
+
+  ws_deque(const ws_deque &) = delete;
+  ws_deque &operator=(const ws_deque &) = delete;
+
+  ~ws_deque();
+
+  // Моментальный снимок, в многопоточной программе сразу устаревает
+  size_type size() const noexcept;
+  bool empty() const noexcept { return size() == 0; }
+  size_type capacity() const noexcept;
+  // Наибольшая начальная вместимость: старшая степень двойки, при которой
+  // кольцо еще умещается в адресное пространство
+  static constexpr size_type max_size() noexcept {
+    size_type limit = size_type(PTRDIFF_MAX) / sizeof(std::atomic<T>);
+    size_type rounded = 1;
+    while (rounded <= limit / 2) rounded *= 2;
+    return rounded;
+  }
+
+  // Владелец. Кладет элемент на нижний конец, при необходимости растет
+  void push(const_reference value);
+  // Владелец. Забирает последний положенный элемент, false - если пусто
+  bool pop(reference value) noexcept;
+  // Любой поток. Забирает самый старый элемент. false - если дек пуст или
+  // элемент увел другой поток: повторить можно у другой жертвы
+  bool steal(reference value) noexcept;
+
+ private:
+  static constexpr size_type kMinCapacity = 16;
+
+  struct Array {
+    explicit Array(size_type capacity)
+        : mask_(capacity - 1), cells_(new std::atomic<T>[capacity]) {}
+
+    size_type capacity() const noexcept { return mask_ + 1; }
+    T get(std::ptrdiff_t index) const noexcept {
+      return cells_[index & mask_].load(std::memory_order_relaxed);
+    }
+    void put(std::ptrdiff_t index, const T &value) noexcept {
+      cells_[index & mask_].store(value, std::memory_order_relaxed);
+    }
+
+    size_type mask_;
+    std::unique_ptr<std::atomic<T>[]> cells_;
+    // Предыдущее, меньшее кольцо: освобождается вместе с деком
+    std::unique_ptr<Array> retired_;
+  };
+
+  Array *grow(Array *array, std::ptrdiff_t top, std::ptrdiff_t bottom);
+
+  // top_ меняют воры, bottom_ и array_ - только владелец
+  alignas(kCacheLineSize) std::atomic<std::ptrdiff_t> top_{0};
+  alignas(kCacheLineSize) std::atomic<std::ptrdiff_t> bottom_{0};
+  std::atomic<Array *> array_;
+};
+
+template <typename T>
+ws_deque<T>::ws_deque(size_type capacity) {
+  if (capacity > max_size())
+    throw std::length_error("ws_deque::capacity is too big");
+  size_type rounded = kMinCapacity;
+  while (rounded < capacity) rounded *= 2;
+  array_.store(new Array(rounded), std::memory_order_relaxed);
+}
+
+template <typename T>
+ws_deque<T>::~ws_deque() {
+  delete array_.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+typename ws_deque<T>::size_type ws_deque<T>::size() const noexcept {
+  std::ptrdiff_t bottom = bottom_.load(std::memory_order_acquire);
+  std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+  // pop на время уменьшает bottom_ до top_ - 1
+  return bottom > top ? size_type(bottom - top) : 0;
+}
+
+template <typename T>
+typename ws_deque<T>::size_type ws_deque<T>::capacity() const noexcept {
+  return array_.load(std::memory_order_acquire)->capacity();
+}
+
+template <typename T>
+void ws_deque<T>::push(const_reference value) {
+  std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed);
+  std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+  Array *array = array_.load(std::memory_order_relaxed);
+  if (bottom - top > std::ptrdiff_t(array->mask_))
+    array = grow(array, top, bottom);
+  array->put(bottom, value);
+  // release публикует ячейку и новое кольцо для вора, прочитавшего bottom_
+  bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+template <typename T>
+bool ws_deque<T>::pop(reference value) noexcept {
+  std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Array *array = array_.load(std::memory_order_relaxed);
+  // Сначала занять элемент уменьшением bottom_, затем смотреть на top_.
+  // Вор делает наоборот, и seq_cst не дает обоим пропустить друг друга
+  bottom_.store(bottom, std::memory_order_seq_cst);
+  std::ptrdiff_t top = top_.load(std::memory_order_seq_cst);
+  bool popped = top <= bottom;
+  if (popped) {
+    value = array->get(bottom);
+    if (top != bottom) return true;
+    // последний элемент: соревнуемся с ворами за top_
+    popped = top_.compare_exchange_strong(top, top + 1,
+                                          std::memory_order_seq_cst,
+                                          std::memory_order_relaxed);
+  }
+  bottom_.store(bottom + 1, std::memory_order_relaxed);
+  return popped;
+}
+
+template <typename T>
+bool ws_deque<T>::steal(reference value) noexcept {
+  std::ptrdiff_t top = top_.load(std::memory_order_seq_cst);
+  std::ptrdiff_t bottom = bottom_.load(std::memory_order_seq_cst);
+  if (top >= bottom) return false;
+  Array *array = array_.load(std::memory_order_acquire);
+  T stolen = array->get(top);
+  // прочитанная ячейка наша, только если top_ никто не сдвинул
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed))
+    return false;
+  value = stolen;
+  return true;
+}
+
+template <typename T>
+typename ws_deque<T>::Array *ws_deque<T>::grow(Array *array,
+                                               std::ptrdiff_t top,
+                                               std::ptrdiff_t bottom) {
+  auto bigger = std::make_unique<Array>(array->capacity() * 2);
+  for (std::ptrdiff_t i = top; i < bottom; ++i) bigger->put(i, array->get(i));
+  bigger->retired_.reset(array);
+  Array *result = bigger.release();
+  array_.store(result, std::memory_order_release);
+  return result;
+}
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_WS_DEQUE_H_
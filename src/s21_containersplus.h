@@ -3,6 +3,16 @@
 
 #include "s21_containers.h"
 #include "s21_containers/s21_array.h"
+#include "s21_containers/s21_btree_map.h"
+#include "s21_containers/s21_btree_set.h"
+#include "s21_containers/s21_frozen_map.h"
+#include "s21_containers/s21_frozen_set.h"
+#include "s21_containers/s21_mpmc_queue.h"
 #include "s21_containers/s21_multiset.h"
+#include "s21_containers/s21_priority_queue.h"
+#include "s21_containers/s21_ring_buffer.h"
+#include "s21_containers/s21_small_vector.h"
+#include "s21_containers/s21_spsc_queue.h"
+#include "s21_containers/s21_ws_deque.h"
 
 #endif  // S21_CONTAINERSPLUS_H
\ No newline at end of file
@@ -0,0 +1,179 @@
+#include <memory_resource>
+
+#include "test_header.h"
+namespace {
+// Ресурс, который считает выделенные через него и еще не освобожденные байты
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  std::size_t in_use() const noexcept { return in_use_; }
+
+  std::size_t allocations() const noexcept { return allocations_; }
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t align) override {
+    in_use_ += bytes;
+    ++allocations_;
+    return std::pmr::new_delete_resource()->allocate(bytes, align);
+  }
+
+  void do_deallocate(void *ptr, std::size_t bytes,
+                     std::size_t align) override {
+    in_use_ -= bytes;
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+  std::size_t in_use_ = 0;
+  std::size_t allocations_ = 0;
+};
+
+const char kLong[] = "long enough string to be allocated outside of sso";
+
+TEST(Allocator, Pmr_All_Memory_From_Resource) {
+  CountingResource resource;
+  {
+    s21::pmr::vector<std::pmr::string> vector(&resource);
+    s21::pmr::list<std::pmr::string> list(&resource);
+    s21::pmr::set<std::pmr::string> set(&resource);
+    s21::pmr::multiset<int> multiset(&resource);
+    s21::pmr::map<int, int> map(&resource);
+    s21::pmr::stack<int> stack(&resource);
+    s21::pmr::queue<int> queue(&resource);
+    for (int i = 0; i < 100; ++i) {
+      vector.emplace_back(kLong);
+      list.push_back(std::pmr::string(kLong, &resource));
+      set.insert(std::pmr::string(kLong + std::to_string(i), &resource));
+      multiset.insert(i % 10);
+      map.insert(i, i);
+      stack.push(i);
+      queue.push(i);
+    }
+    // элементы, которым нужен аллокатор, получают ресурс контейнера
+    EXPECT_EQ(vector[0].get_allocator().resource(), &resource);
+    EXPECT_EQ((*set.begin()).get_allocator().resource(), &resource);
+    EXPECT_EQ(multiset.count(3), size_t(10));
+    EXPECT_EQ(map.at(42), 42);
+    EXPECT_EQ(stack.top(), 99);
+    EXPECT_EQ(queue.front(), 0);
+    EXPECT_EQ(vector.get_allocator().resource(), &resource);
+    EXPECT_EQ(map.get_allocator().resource(), &resource);
+    EXPECT_GT(resource.in_use(), size_t(0));
+  }
+  EXPECT_GT(resource.allocations(), size_t(0));
+  EXPECT_EQ(resource.in_use(), size_t(0));
+}
+
+TEST(Allocator, Pmr_Copy_And_Move_Keep_Resource) {
+  CountingResource first, second;
+  {
+    s21::pmr::vector<std::pmr::string> vector(&first);
+    s21::pmr::list<int> list({1, 2, 3}, &first);
+    s21::pmr::set<int> set({1, 2, 3}, &first);
+    for (int i = 0; i < 10; ++i) vector.emplace_back(kLong);
+
+    // копия получает ресурс по умолчанию, а не ресурс источника
+    s21::pmr::vector<std::pmr::string> copy(vector);
+    EXPECT_EQ(copy.get_allocator().resource(),
+              std::pmr::get_default_resource());
+
+    // полиморфный аллокатор не распространяется при присваивании: элементы
+    // переносятся по одному в память второго ресурса
+    s21::pmr::vector<std::pmr::string> other_vector(&second);
+    s21::pmr::list<int> other_list(&second);
+    s21::pmr::set<int> other_set(&second);
+    other_vector = std::move(vector);
+    other_list = std::move(list);
+    other_set = std::move(set);
+    EXPECT_EQ(other_vector.get_allocator().resource(), &second);
+    EXPECT_EQ(other_vector[9].get_allocator().resource(), &second);
+    EXPECT_EQ(other_vector[9], kLong);
+    EXPECT_EQ(other_list.get_allocator().resource(), &second);
+    EXPECT_EQ(other_list.back(), 3);
+    EXPECT_EQ(other_set.get_allocator().resource(), &second);
+    EXPECT_TRUE(other_set.contains(2));
+
+    // при равных ресурсах буфер забирается без выделений
+    std::size_t allocations = second.allocations();
+    s21::pmr::vector<std::pmr::string> moved(std::move(other_vector),
+                                             &second);
+    EXPECT_EQ(second.allocations(), allocations);
+    EXPECT_EQ(moved.size(), size_t(10));
+    EXPECT_EQ(moved[0].get_allocator().resource(), &second);
+  }
+  EXPECT_EQ(first.in_use(), size_t(0));
+  EXPECT_EQ(second.in_use(), size_t(0));
+}
+
+TEST(Allocator, Pmr_Monotonic_Arena) {
+  alignas(std::max_align_t) char buffer[1 << 16];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  s21::pmr::list<int> list(&arena);
+  s21::pmr::map<int, int> map(&arena);
+  s21::pmr::vector<int> vector(&arena);
+  vector.reserve(100);
+  for (int i = 0; i < 100; ++i) {
+    list.push_front(i);
+    map[i] = i * i;
+    vector.push_back(i);
+  }
+  EXPECT_EQ(list.front(), 99);
+  EXPECT_EQ(map[9], 81);
+  EXPECT_EQ(vector.back(), 99);
+  // арена не обращается к куче: превышение буфера бросило бы bad_alloc
+  s21::pmr::list<int> swapped(&arena);
+  swapped.swap(list);
+  EXPECT_EQ(swapped.size(), size_t(100));
+  EXPECT_TRUE(list.empty());
+}
+TEST(Allocator, Pmr_Failed_Transfer_Loses_Nothing) {
+  alignas(std::max_align_t) char buffer[4096];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  // ресурсы разные, поэтому элементы other переносятся в новые узлы
+  // арены, а их там не хватает
+  s21::pmr::set<std::pmr::string> set({"a", "b"}, &arena);
+  s21::pmr::set<std::pmr::string> other;
+  for (int i = 0; i < 200; ++i) {
+    std::pmr::string key(kLong);
+    key += std::to_string(i);
+    other.insert(key);
+  }
+  EXPECT_THROW(set.set_union(other), std::bad_alloc);
+  EXPECT_EQ(set.size(), size_t(2));
+  EXPECT_EQ(other.size(), size_t(200));
+  EXPECT_EQ((*other.begin()).substr(0, 4), "long");
+  // merge переносит элементы по одному: часть успевает перейти
+  EXPECT_THROW(set.merge(other), std::bad_alloc);
+  EXPECT_EQ(set.size() + other.size(), size_t(202));
+  s21::pmr::multiset<int> multiset({1, 2}, &arena);
+  s21::pmr::multiset<int> other_multiset;
+  for (int i = 0; i < 2000; ++i) other_multiset.insert(i % 7);
+  EXPECT_THROW(multiset.merge(other_multiset), std::bad_alloc);
+  EXPECT_EQ(multiset.size(), size_t(2));
+  EXPECT_EQ(other_multiset.count(6), size_t(285));
+}
+
+TEST(Allocator, Pmr_List_Values_Use_Resource) {
+  CountingResource resource;
+  {
+    s21::pmr::list<std::pmr::string> list(&resource);
+    EXPECT_EQ(resource.allocations(), size_t(0));
+    list.emplace_back(kLong);
+    list.push_front(kLong);
+    EXPECT_EQ(list.back().get_allocator().resource(), &resource);
+    EXPECT_EQ(list.front().get_allocator().resource(), &resource);
+    std::size_t allocations = resource.allocations();
+    // узел берется из запаса списка, новое выделение только под строку
+    list.pop_front();
+    list.emplace_back(kLong);
+    EXPECT_EQ(resource.allocations(), allocations + 1);
+  }
+  EXPECT_EQ(resource.in_use(), size_t(0));
+}
+
+}  // namespace
@@ -0,0 +1,156 @@
+#include "test_header.h"
+
+namespace {
+TEST(BTreeSet, Modifier_Insert_Erase) {
+  // маленькие узлы, чтобы дерево было высоким
+  s21::btree_set<int, std::less<int>, 16> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 3000; ++i) {
+    int key = (i * 7919) % 2003;
+    EXPECT_EQ(s21_set.insert(key).second, std_set.insert(key).second);
+  }
+  for (int i = 0; i < 2500; ++i) {
+    int key = (i * 31) % 2011;
+    auto it = s21_set.find(key);
+    EXPECT_EQ(it != s21_set.end(), std_set.count(key) == 1);
+    if (it != s21_set.end()) s21_set.erase(it);
+    std_set.erase(key);
+  }
+  EXPECT_EQ(s21_set.size(), std_set.size());
+  EXPECT_TRUE(std::equal(s21_set.begin(), s21_set.end(), std_set.begin(),
+                         std_set.end()));
+  for (int key = -1; key < 2005; ++key) {
+    auto lower = std_set.lower_bound(key);
+    auto upper = std_set.upper_bound(key);
+    EXPECT_EQ(s21_set.lower_bound(key) == s21_set.end(),
+              lower == std_set.end());
+    if (lower != std_set.end()) {
+      EXPECT_EQ(*s21_set.lower_bound(key), *lower);
+    }
+    if (upper != std_set.end()) {
+      EXPECT_EQ(*s21_set.upper_bound(key), *upper);
+    }
+  }
+  auto it = s21_set.end();
+  for (auto rit = std_set.rbegin(); rit != std_set.rend(); ++rit)
+    EXPECT_EQ(*--it, *rit);
+  EXPECT_TRUE(it == s21_set.begin());
+}
+
+TEST(BTreeSet, Modifier_Merge) {
+  s21::btree_set<std::string, std::less<>> s21_set_1 = {"aboba", "shleppa"};
+  s21::btree_set<std::string, std::less<>> s21_set_2 = {"amogus", "aboba"};
+  s21_set_1.merge(s21_set_2);
+  EXPECT_EQ(s21_set_1.size(), size_t(3));
+  EXPECT_EQ(s21_set_2.size(), size_t(1));
+  EXPECT_TRUE(s21_set_2.contains(std::string_view("aboba")));
+  EXPECT_EQ(*s21_set_1.lower_bound(std::string_view("ac")), "amogus");
+  s21::btree_set<std::string, std::less<>> copy = s21_set_1;
+  s21_set_1.clear();
+  EXPECT_TRUE(s21_set_1.empty());
+  EXPECT_EQ(copy.size(), size_t(3));
+}
+
+TEST(BTreeSet, Constructor_Move_And_Clear_Leave_No_Nodes) {
+  static_assert(std::is_nothrow_move_constructible<s21::btree_set<int>>::value,
+                "move must not allocate");
+  const s21::btree_set<int> empty;
+  EXPECT_TRUE(empty.begin() == empty.end());
+  EXPECT_TRUE(empty.find(1) == empty.end());
+  EXPECT_TRUE(empty.lower_bound(1) == empty.end());
+  EXPECT_FALSE(empty.contains(1));
+  s21::btree_set<int> s21_set = {3, 1, 2};
+  s21::btree_set<int> moved = std::move(s21_set);
+  EXPECT_EQ(moved.size(), size_t(3));
+  // перенесенное и очищенное множества без узлов остаются рабочими
+  EXPECT_TRUE(s21_set.begin() == s21_set.end());
+  s21_set.erase(s21_set.begin());
+  s21_set.merge(moved);
+  EXPECT_EQ(s21_set.size(), size_t(3));
+  EXPECT_TRUE(moved.empty());
+  s21_set.clear();
+  EXPECT_TRUE(s21_set.begin() == s21_set.end());
+  EXPECT_TRUE(s21_set.insert(5).second);
+  EXPECT_EQ(*s21_set.begin(), 5);
+}
+
+// Ключ, копирование которого бросает по требованию. Перемещение не
+// бросает, поэтому при вставке rvalue копируется только разделитель
+struct FragileKey {
+  static bool fail_copy;
+
+  explicit FragileKey(int key) : value(key) {}
+  FragileKey(const FragileKey &other) : value(other.value) {
+    if (fail_copy) throw std::runtime_error("copy");
+  }
+  FragileKey(FragileKey &&other) noexcept = default;
+  FragileKey &operator=(const FragileKey &other) = default;
+  FragileKey &operator=(FragileKey &&other) noexcept = default;
+  bool operator<(const FragileKey &other) const { return value < other.value; }
+
+  int value;
+};
+
+bool FragileKey::fail_copy = false;
+
+TEST(BTreeSet, Modifier_Insert_Split_Failure_Keeps_Tree) {
+  s21::btree_set<FragileKey, std::less<FragileKey>, 16> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 200; i += 2) {
+    s21_set.insert(FragileKey(i));
+    std_set.insert(i);
+  }
+  // каждое деление листа падает на копии разделителя, вставки без деления
+  // проходят
+  FragileKey::fail_copy = true;
+  int failures = 0;
+  for (int i = 0; i < 400; ++i) {
+    int key = (i * 37) % 401 - 1;
+    try {
+      if (s21_set.insert(FragileKey(key)).second) std_set.insert(key);
+    } catch (const std::runtime_error &) {
+      ++failures;
+    }
+    ASSERT_EQ(s21_set.size(), std_set.size());
+  }
+  FragileKey::fail_copy = false;
+  EXPECT_GT(failures, 0);
+  std::vector<int> forward, backward;
+  for (const FragileKey &key : s21_set) forward.push_back(key.value);
+  for (auto it = s21_set.end(); it != s21_set.begin();)
+    backward.insert(backward.begin(), (*--it).value);
+  EXPECT_EQ(forward, std::vector<int>(std_set.begin(), std_set.end()));
+  EXPECT_EQ(backward, forward);
+  for (int key : std_set) EXPECT_TRUE(s21_set.contains(FragileKey(key)));
+}
+
+TEST(BTreeMap, Modifier_Insert_Erase) {
+  s21::btree_map<std::string, int, std::less<std::string>, 64> s21_map;
+  std::map<std::string, int> std_map;
+  for (int i = 0; i < 2000; ++i) {
+    std::string key = std::to_string((i * 7919) % 1009);
+    ++s21_map[key];
+    ++std_map[key];
+  }
+  for (int i = 0; i < 1500; i += 2) {
+    std::string key = std::to_string(i);
+    auto it = s21_map.find(key);
+    if (it != s21_map.end()) s21_map.erase(it);
+    std_map.erase(key);
+  }
+  EXPECT_EQ(s21_map.size(), std_map.size());
+  auto it = s21_map.begin();
+  for (const auto &item : std_map) {
+    EXPECT_EQ(it->first, item.first);
+    EXPECT_EQ(it->second, item.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == s21_map.end());
+  EXPECT_THROW(s21_map.at("0"), std::out_of_range);
+  EXPECT_FALSE(s21_map.insert_or_assign("1", 42).second);
+  EXPECT_EQ(s21_map.at("1"), 42);
+  EXPECT_TRUE(s21_map.insert("aboba", 7).second);
+  EXPECT_FALSE(s21_map.try_emplace("aboba", 8).second);
+  EXPECT_EQ(s21_map.at("aboba"), 7);
+}
+}  // namespace
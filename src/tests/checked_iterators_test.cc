@@ -0,0 +1,76 @@
+#include "test_header.h"
+namespace {
+TEST(CheckedIterators, Operator_Index) {
+  s21::vector<int> s21_vector = {1, 2, 3};
+  s21::array<int, 3> s21_array = {4, 5, 6};
+  s21_vector[1] = 7;
+  s21_array[2] = 8;
+  EXPECT_EQ(s21_vector[1], 7);
+  EXPECT_EQ(s21_array[2], 8);
+  const s21::vector<int> &const_vector = s21_vector;
+  EXPECT_EQ(const_vector[2], 3);
+  EXPECT_THROW(const_vector.at(3), std::logic_error);
+  s21::vector<int>::const_iterator it = s21_vector.begin();
+  EXPECT_TRUE(it == s21_vector.begin());
+  EXPECT_EQ(s21_vector.end() - it, 3);
+}
+
+#ifdef S21_CHECKED_ITERATORS
+TEST(CheckedIterators, Vector) {
+  s21::vector<int> s21_vector = {1, 2, 3};
+  s21::vector<int> other = {1, 2, 3};
+  EXPECT_THROW(s21_vector[3], std::out_of_range);
+  EXPECT_THROW(*s21_vector.end(), std::out_of_range);
+  EXPECT_THROW(--s21_vector.begin(), std::out_of_range);
+  EXPECT_THROW(s21_vector.begin() + 4, std::out_of_range);
+  EXPECT_THROW((void)(s21_vector.begin() == other.begin()), std::out_of_range);
+  EXPECT_THROW(s21_vector.erase(other.begin()), std::out_of_range);
+  auto it = s21_vector.begin();
+  s21_vector.push_back(4);
+  EXPECT_THROW(*it, std::out_of_range);
+  it = s21_vector.begin() + 1;
+  s21_vector.erase(s21_vector.begin());
+  EXPECT_THROW(*it, std::out_of_range);
+  it = s21_vector.begin();
+  EXPECT_EQ(*it, 2);
+  s21_vector.pop_back();
+  EXPECT_THROW(it[2], std::out_of_range);
+}
+
+TEST(CheckedIterators, Array) {
+  s21::array<int, 3> s21_array = {1, 2, 3};
+  EXPECT_THROW(s21_array[3], std::out_of_range);
+  EXPECT_THROW(*s21_array.end(), std::out_of_range);
+  EXPECT_THROW(s21_array.end() + 1, std::out_of_range);
+  int sum = 0;
+  for (int item : s21_array) sum += item;
+  EXPECT_EQ(sum, 6);
+}
+
+TEST(CheckedIterators, List) {
+  s21::list<int> s21_list = {1, 2, 3};
+  s21::list<int> other = {4};
+  EXPECT_THROW(*s21_list.end(), std::out_of_range);
+  EXPECT_THROW(++s21_list.end(), std::out_of_range);
+  EXPECT_THROW(s21_list.insert(other.begin(), 5), std::out_of_range);
+  EXPECT_THROW(s21_list.erase(other.begin()), std::out_of_range);
+  EXPECT_EQ(s21_list.size(), size_t(3));
+  EXPECT_EQ(other.size(), size_t(1));
+}
+
+TEST(CheckedIterators, Tree) {
+  s21::set<int> s21_set = {1, 2, 3};
+  s21::set<int> other = {1, 2, 3};
+  s21::map<int, int> s21_map = {{1, 1}};
+  EXPECT_THROW(*s21_set.end(), std::out_of_range);
+  EXPECT_THROW((*s21_map.end()).second, std::out_of_range);
+  EXPECT_THROW(s21_set.erase(other.begin()), std::out_of_range);
+  EXPECT_THROW(s21_set.extract(other.begin()), std::out_of_range);
+  EXPECT_EQ(s21_set.size(), size_t(3));
+  EXPECT_EQ(other.size(), size_t(3));
+  s21_set.erase(s21_set.begin());
+  EXPECT_EQ(*s21_set.begin(), 2);
+}
+#endif
+
+}  // namespace
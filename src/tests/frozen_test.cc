@@ -0,0 +1,69 @@
+#include "test_header.h"
+
+namespace {
+TEST(FrozenSet, Constructor_From_Set) {
+  s21::set<int> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 1000; ++i) {
+    s21_set.insert((i * 37) % 1543);
+    std_set.insert((i * 37) % 1543);
+  }
+  s21::frozen_set<int> frozen(s21_set);
+  EXPECT_EQ(frozen.size(), std_set.size());
+  auto it = frozen.begin();
+  for (auto item : std_set) {
+    EXPECT_EQ(*it, item);
+    ++it;
+  }
+  EXPECT_TRUE(it == frozen.end());
+  for (auto rit = std_set.rbegin(); rit != std_set.rend(); ++rit) {
+    --it;
+    EXPECT_EQ(*it, *rit);
+  }
+}
+
+TEST(FrozenSet, Lookup) {
+  std::vector<int> items;
+  for (int i = 0; i < 777; ++i) items.push_back((i * 7) % 500 * 2);
+  s21::frozen_set<int> frozen(items.begin(), items.end());
+  std::set<int> std_set(items.begin(), items.end());
+  EXPECT_EQ(frozen.size(), std_set.size());
+  for (int key = -2; key < 1003; ++key) {
+    EXPECT_EQ(frozen.contains(key), std_set.count(key) == 1);
+    EXPECT_EQ(frozen.count(key), std_set.count(key));
+    auto lower = frozen.lower_bound(key);
+    auto upper = frozen.upper_bound(key);
+    if (std_set.lower_bound(key) == std_set.end())
+      EXPECT_TRUE(lower == frozen.end());
+    else
+      EXPECT_EQ(*lower, *std_set.lower_bound(key));
+    if (std_set.upper_bound(key) == std_set.end())
+      EXPECT_TRUE(upper == frozen.end());
+    else
+      EXPECT_EQ(*upper, *std_set.upper_bound(key));
+  }
+  s21::frozen_set<int> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.begin() == empty.end());
+  EXPECT_FALSE(empty.contains(0));
+}
+
+TEST(FrozenMap, Lookup) {
+  s21::map<std::string, int, std::less<>> s21_map = {
+      {"aboba", 1}, {"shleppa", 2}, {"amogus", 3}, {"abobus", 4}};
+  s21::frozen_map<std::string, int, std::less<>> frozen(s21_map);
+  EXPECT_EQ(frozen.size(), size_t(4));
+  EXPECT_EQ(frozen.at("amogus"), 3);
+  EXPECT_THROW(frozen.at("sus"), std::out_of_range);
+  EXPECT_EQ(frozen.find(std::string_view("abobus"))->second, 4);
+  EXPECT_EQ(frozen.lower_bound("ac")->first, "amogus");
+  EXPECT_TRUE(frozen.upper_bound("shleppa") == frozen.end());
+  std::vector<std::string> keys;
+  for (const auto &item : frozen) keys.push_back(item.first);
+  EXPECT_EQ(keys, std::vector<std::string>(
+                      {"aboba", "abobus", "amogus", "shleppa"}));
+  s21::frozen_map<int, int> from_list = {{3, 30}, {1, 10}, {3, 33}, {2, 20}};
+  EXPECT_EQ(from_list.size(), size_t(3));
+  EXPECT_EQ(from_list.at(3), 30);
+}
+}  // namespace
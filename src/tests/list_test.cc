@@ -202,4 +202,155 @@ TEST(List, Modifier_Sort) {
   }
 }
 
+TEST(List, Modifier_Emplace_In_Place) {
+  s21::list<std::pair<int, std::string>> s21_list;
+  auto &back = s21_list.emplace_back(2, "b");
+  EXPECT_EQ(back.second, "b");
+  s21_list.emplace_front(1, "a");
+  auto it = s21_list.emplace(s21_list.end(), 3, "c");
+  EXPECT_EQ((*it).first, 3);
+  EXPECT_EQ(s21_list.size(), size_t(3));
+  EXPECT_EQ(s21_list.front().second, "a");
+  EXPECT_EQ(s21_list.back().second, "c");
+}
+
+TEST(List, Modifier_Insert_Many) {
+  s21::list<int> s21_list = {1, 5};
+  auto it = s21_list.insert_many(++s21_list.begin(), 2, 3, 4);
+  EXPECT_EQ(*it, 4);
+  s21_list.insert_many_back(6, 7);
+  s21_list.insert_many_front(-1, 0);
+  std::list<int> std_list = {-1, 0, 1, 2, 3, 4, 5, 6, 7};
+  EXPECT_EQ(s21_list.size(), std_list.size());
+  auto it2 = std_list.begin();
+  for (auto it1 = s21_list.begin(); it1 != s21_list.end(); ++it1, ++it2)
+    EXPECT_EQ(*it1, *it2);
+}
+
+TEST(List, Modifier_Sort_Stable_Comparator) {
+  s21::list<std::pair<int, int>> s21_list;
+  std::list<std::pair<int, int>> std_list;
+  unsigned seed = 7;
+  for (int i = 0; i < 1000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    s21_list.emplace_back(int(seed >> 16) % 50, i);
+    std_list.emplace_back(int(seed >> 16) % 50, i);
+  }
+  // сравниваются только ключи: при равных ключах сохраняется исходный
+  // порядок вторых элементов
+  auto by_key_desc = [](const auto &lhs, const auto &rhs) {
+    return lhs.first > rhs.first;
+  };
+  s21_list.sort(by_key_desc);
+  std_list.sort(by_key_desc);
+  ASSERT_EQ(s21_list.size(), std_list.size());
+  auto it2 = std_list.begin();
+  for (auto it1 = s21_list.begin(); it1 != s21_list.end(); ++it1, ++it2)
+    EXPECT_EQ(*it1, *it2);
+  EXPECT_EQ(*--s21_list.end(), std_list.back());
+}
+
+TEST(List, Modifier_Sort_Relinks_Nodes) {
+  s21::list<std::string> s21_list{"d", "b", "e", "a", "c"};
+  auto it = s21_list.begin();
+  const std::string *address = &*it;
+  s21_list.sort();
+  // узел не копировался: итератор указывает на то же значение
+  EXPECT_EQ(*it, "d");
+  EXPECT_EQ(&*it, address);
+  EXPECT_EQ(s21_list.front(), "a");
+  EXPECT_EQ(s21_list.back(), "e");
+  s21_list.push_back("b");
+  EXPECT_EQ(s21_list.size(), size_t(6));
+  s21::list<std::string> empty;
+  empty.sort();
+  EXPECT_TRUE(empty.empty());
+}
+
+TEST(List, Modifier_Merge_Comparator_Relinks) {
+  s21::list<std::pair<int, char>> s21_list_1 = {{9, 'a'}, {5, 'a'}, {1, 'a'}};
+  s21::list<std::pair<int, char>> s21_list_2 = {{8, 'b'}, {5, 'b'}, {0, 'b'}};
+  const auto *address = &*s21_list_2.begin();
+  auto greater_key = [](const auto &lhs, const auto &rhs) {
+    return lhs.first > rhs.first;
+  };
+  s21_list_1.merge(s21_list_2, greater_key);
+  EXPECT_TRUE(s21_list_2.empty());
+  std::vector<std::pair<int, char>> expected = {
+      {9, 'a'}, {8, 'b'}, {5, 'a'}, {5, 'b'}, {1, 'a'}, {0, 'b'}};
+  ASSERT_EQ(s21_list_1.size(), expected.size());
+  auto it = s21_list_1.begin();
+  for (size_t i = 0; i < expected.size(); ++i, ++it)
+    EXPECT_EQ(*it, expected[i]);
+  // элемент other перешел вместе со своим узлом
+  EXPECT_EQ(&*++s21_list_1.begin(), address);
+  EXPECT_EQ(*--s21_list_1.end(), expected.back());
+  s21_list_2.push_back({3, 'c'});
+  EXPECT_EQ(s21_list_2.size(), size_t(1));
+}
+
+TEST(List, Modifier_Splice_Forms) {
+  s21::list<int> s21_list_1 = {1, 2, 3};
+  s21::list<int> s21_list_2 = {10, 20, 30, 40};
+  std::list<int> std_list_1 = {1, 2, 3};
+  std::list<int> std_list_2 = {10, 20, 30, 40};
+  auto s21_pos = ++s21_list_1.begin();
+  auto std_pos = ++std_list_1.begin();
+  // один элемент
+  s21_list_1.splice(s21_pos, s21_list_2, ++s21_list_2.begin());
+  std_list_1.splice(std_pos, std_list_2, ++std_list_2.begin());
+  // диапазон [30, end) из другого списка
+  s21_list_1.splice(s21_list_1.begin(), s21_list_2, ++s21_list_2.begin(),
+                    s21_list_2.end());
+  std_list_1.splice(std_list_1.begin(), std_list_2, ++std_list_2.begin(),
+                    std_list_2.end());
+  // диапазон внутри одного списка
+  s21_list_1.splice(s21_list_1.end(), s21_list_1, s21_list_1.begin(),
+                    s21_pos);
+  std_list_1.splice(std_list_1.end(), std_list_1, std_list_1.begin(),
+                    std_pos);
+  // весь список
+  s21_list_1.splice(s21_pos, s21_list_2);
+  std_list_1.splice(std_pos, std_list_2);
+  EXPECT_TRUE(s21_list_2.empty());
+  ASSERT_EQ(s21_list_1.size(), std_list_1.size());
+  auto it2 = std_list_1.begin();
+  for (auto it1 = s21_list_1.begin(); it1 != s21_list_1.end(); ++it1, ++it2)
+    EXPECT_EQ(*it1, *it2);
+  auto back = std_list_1.rbegin();
+  for (auto it1 = s21_list_1.end(); it1 != s21_list_1.begin(); ++back)
+    EXPECT_EQ(*--it1, *back);
+}
+
+TEST(List, Node_Reuse_And_Valueless_End) {
+  // значение без конструктора по умолчанию: фиктивному узлу оно не нужно
+  struct Item {
+    explicit Item(int value) : value_(value) {}
+    int value_;
+  };
+  s21::list<Item> s21_list;
+  EXPECT_TRUE(s21_list.begin() == s21_list.end());
+  static_assert(std::is_nothrow_move_constructible_v<s21::list<Item>>);
+  s21_list.emplace_back(1);
+  s21_list.emplace_back(2);
+  const Item *address = &s21_list.back();
+  s21_list.pop_back();
+  // узел удаленного элемента используется повторно
+  s21_list.emplace_front(3);
+  EXPECT_EQ(&s21_list.front(), address);
+  EXPECT_EQ(s21_list.front().value_, 3);
+  s21::list<Item> moved(std::move(s21_list));
+  EXPECT_TRUE(s21_list.empty());
+  EXPECT_TRUE(s21_list.begin() == s21_list.end());
+  EXPECT_EQ(moved.size(), size_t(2));
+  EXPECT_EQ((*--moved.end()).value_, 1);
+  s21_list.emplace_back(4);
+  s21_list.swap(moved);
+  EXPECT_EQ(s21_list.back().value_, 1);
+  EXPECT_EQ(moved.back().value_, 4);
+  moved.clear();
+  moved.shrink_to_fit();
+  EXPECT_TRUE(moved.begin() == moved.end());
+}
+
 }  // namespace
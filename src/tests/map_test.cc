@@ -1,3 +1,5 @@
+#include <thread>
+
 #include "test_header.h"
 
 namespace {
@@ -183,4 +185,166 @@ TEST(Map, Modifier_Swap) {
   EXPECT_EQ(s21_map_2.size(), s21_map_3.size());
 }
 
+TEST(Map, Constructor_Range) {
+  std::vector<std::pair<int, std::string>> items = {
+      {1, "aboba"}, {2, "shleppa"}, {3, "amogus"}, {4, "abobus"}};
+  s21::map<int, std::string> s21_map(items.begin(), items.end());
+  std::map<int, std::string> std_map(items.begin(), items.end());
+  EXPECT_EQ(s21_map.size(), std_map.size());
+  for (auto item : std_map) {
+    EXPECT_EQ(s21_map.at(item.first), item.second);
+  }
+}
+
+TEST(Map, Lookup_Order_Statistic) {
+  s21::map<int, std::string, std::greater<int>, s21::OrderStatistic> s21_map =
+      {{10, "ten"}, {40, "forty"}, {20, "twenty"}, {30, "thirty"}};
+  EXPECT_EQ((*s21_map.find_by_order(0)).second, "forty");
+  EXPECT_EQ((*s21_map.find_by_order(3)).second, "ten");
+  EXPECT_EQ(s21_map.order_of_key(30), size_t(1));
+  EXPECT_EQ(s21_map.order_of_key(25), size_t(2));
+  s21_map.erase(s21_map.find_by_order(1));
+  EXPECT_EQ((*s21_map.find_by_order(1)).second, "twenty");
+}
+
+TEST(Map, Modifier_Extract_Insert_Node) {
+  s21::map<int, std::string> s21_map = {{1, "one"}, {2, "two"}, {3, "three"}};
+  auto node = s21_map.extract(2);
+  EXPECT_FALSE(node.empty());
+  EXPECT_EQ(s21_map.size(), size_t(2));
+  EXPECT_FALSE(s21_map.contains(2));
+  // меняем ключ без копирования значения
+  node.key() = 4;
+  auto res = s21_map.insert(std::move(node));
+  EXPECT_TRUE(res.inserted);
+  EXPECT_TRUE(res.node.empty());
+  EXPECT_EQ((*res.position).second, "two");
+  EXPECT_EQ(s21_map.at(4), "two");
+  // ключ уже есть - узел возвращается обратно
+  auto dup = s21_map.extract(s21_map.begin());
+  dup.key() = 3;
+  res = s21_map.insert(std::move(dup));
+  EXPECT_FALSE(res.inserted);
+  EXPECT_FALSE(res.node.empty());
+  EXPECT_EQ(res.node.mapped(), "one");
+  EXPECT_EQ(s21_map.size(), size_t(2));
+  EXPECT_TRUE(s21_map.extract(5).empty());
+}
+
+TEST(Map, Modifier_Transfer_Node_Keeps_Address) {
+  s21::map<int, std::string> hot = {{1, "one"}, {2, "two"}};
+  s21::map<int, std::string> cold = {{3, "three"}};
+  // handle владеет узлом сам: извлеченный узел больше не меняет адрес и
+  // переходит между контейнерами без копирования ключа и значения
+  auto node = hot.extract(2);
+  const std::string *two = &node.mapped();
+  cold.insert(std::move(node));
+  EXPECT_EQ(&cold.at(2), two);
+  hot.insert(cold.extract(3));
+  hot.insert(cold.extract(2));
+  EXPECT_EQ(&hot.at(2), two);
+  cold.insert(hot.extract(2));
+  EXPECT_EQ(&cold.at(2), two);
+  EXPECT_EQ(*two, "two");
+  EXPECT_EQ(hot.at(3), "three");
+  // handle переживает контейнер-источник и тоже не копируется при вставке
+  {
+    s21::map<int, std::string> source = {{5, "five"}};
+    node = source.extract(5);
+  }
+  const std::string *five = &node.mapped();
+  cold.insert(std::move(node));
+  EXPECT_EQ(&cold.at(5), five);
+  hot.clear();
+  EXPECT_EQ(cold.size(), size_t(2));
+}
+
+TEST(Map, Modifier_Promoted_Node_Does_Not_Couple_Maps) {
+  // узел, поднятый из холодной карты в горячую, не связывает их: каждая
+  // карта дальше живет в своем потоке(проверяется в make test_tsan)
+  s21::map<int, std::string> hot;
+  s21::map<int, std::string> cold;
+  for (int i = 0; i < 500; ++i) cold.insert({i, std::to_string(i)});
+  for (int i = 0; i < 500; i += 2) hot.insert(cold.extract(i));
+  auto spare = cold.extract(1);
+  auto churn = [](s21::map<int, std::string> &map, int base) {
+    for (int i = 0; i < 2000; ++i) {
+      map.insert({base + i, "x"});
+      map.erase(map.find(base + i));
+    }
+  };
+  std::thread worker([&] {
+    churn(cold, 1000);
+    spare = s21::map<int, std::string>::node_type();
+  });
+  churn(hot, 1000);
+  hot.clear();
+  worker.join();
+  EXPECT_TRUE(spare.empty());
+  EXPECT_EQ(cold.size(), size_t(249));
+}
+
+TEST(Map, Modifier_Try_Emplace) {
+  s21::map<std::string, std::vector<int>> s21_map;
+  auto res = s21_map.try_emplace("aboba", 3, 7);
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ((*res.first).second, std::vector<int>({7, 7, 7}));
+  // ключ уже есть - значение не создается и не меняется
+  std::vector<int> value = {1, 2};
+  res = s21_map.try_emplace("aboba", std::move(value));
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(value.size(), size_t(2));
+  EXPECT_EQ(s21_map.size(), size_t(1));
+  std::string key = "amogus";
+  s21_map.try_emplace(std::move(key), value);
+  EXPECT_EQ(s21_map.at("amogus"), value);
+}
+
+TEST(Map, Element_Operator_Count) {
+  std::vector<std::string> words = {"a", "b", "a", "c", "b", "a"};
+  s21::map<std::string, int> s21_map;
+  std::map<std::string, int> std_map;
+  for (const auto &word : words) {
+    ++s21_map[word];
+    ++std_map[word];
+  }
+  EXPECT_EQ(s21_map.size(), std_map.size());
+  for (auto item : std_map) EXPECT_EQ(s21_map[item.first], item.second);
+  auto res = s21_map.insert_or_assign("a", 10);
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(s21_map.at("a"), 10);
+  res = s21_map.insert_or_assign("d", 4);
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ((*res.first).second, 4);
+}
+
+TEST(Map, Lookup_Transparent) {
+  s21::map<std::string, std::vector<int>, std::less<>> s21_map = {
+      {"aboba", {1}}, {"amogus", {2, 2}}, {"shleppa", {3, 3, 3}}};
+  std::string_view key = "amogus";
+  EXPECT_EQ((*s21_map.find(key)).second.size(), size_t(2));
+  EXPECT_TRUE(s21_map.contains(key));
+  EXPECT_EQ(s21_map.count(std::string_view("abobus")), size_t(0));
+  EXPECT_EQ((*s21_map.lower_bound(std::string_view("b"))).first, "shleppa");
+  EXPECT_EQ((*s21_map.upper_bound(key)).first, "shleppa");
+  EXPECT_TRUE(s21_map.find(std::string_view("zzz")) == s21_map.end());
+  const auto &const_map = s21_map;
+  EXPECT_EQ(const_map.at("aboba"), std::vector<int>({1}));
+}
+
+TEST(Map, Modifier_Emplace) {
+  s21::map<int, std::string> s21_map;
+  auto res = s21_map.emplace(1, "one");
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ((*res.first).second, "one");
+  res = s21_map.emplace(1, "uno");
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(s21_map.at(1), "one");
+  auto many = s21_map.insert_many(std::pair<int, std::string>(2, "two"),
+                                  std::pair<int, std::string>(1, "uno"));
+  EXPECT_TRUE(many[0].second);
+  EXPECT_FALSE(many[1].second);
+  EXPECT_EQ(s21_map.size(), size_t(2));
+}
+
 }  // namespace
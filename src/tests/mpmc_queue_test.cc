@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "test_header.h"
+namespace {
+TEST(MpmcQueue, Try_Operations_And_Close) {
+  s21::mpmc_queue<std::string> queue(5);
+  EXPECT_EQ(queue.capacity(), size_t(8));
+  std::string value;
+  EXPECT_FALSE(queue.try_pop(value));
+  // несколько кругов по кольцу
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 8; ++i)
+      EXPECT_TRUE(queue.try_push(std::string(30, 'a' + i)));
+    EXPECT_FALSE(queue.try_emplace(30, 'z'));
+    EXPECT_EQ(queue.size(), size_t(8));
+    for (int i = 0; i < 8; ++i) {
+      EXPECT_TRUE(queue.try_pop(value));
+      EXPECT_EQ(value, std::string(30, 'a' + i));
+    }
+    EXPECT_TRUE(queue.empty());
+  }
+  EXPECT_THROW(s21::mpmc_queue<std::string>(SIZE_MAX), std::length_error);
+  EXPECT_THROW(s21::mpmc_queue<std::string>(queue.max_size() + 1),
+               std::length_error);
+  queue.push("left");
+  queue.emplace(2, 'b');
+  queue.close();
+  EXPECT_TRUE(queue.closed());
+  EXPECT_FALSE(queue.push("late"));
+  EXPECT_FALSE(queue.try_push("late"));
+  // положенное до close() дочитывается, затем pop не ждет
+  EXPECT_TRUE(queue.pop(value));
+  EXPECT_EQ(value, "left");
+  EXPECT_TRUE(queue.pop(value));
+  EXPECT_EQ(value, "bb");
+  EXPECT_FALSE(queue.pop(value));
+}
+
+TEST(MpmcQueue, Close_Wakes_Blocked_Threads) {
+  s21::mpmc_queue<int> queue(2);
+  queue.push(1);
+  queue.push(2);
+  bool pushed = true;
+  std::thread producer([&] { pushed = queue.push(3); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  queue.close();
+  producer.join();
+  EXPECT_FALSE(pushed);
+  s21::mpmc_queue<int> empty_queue(2);
+  bool popped = true;
+  std::thread consumer([&] {
+    int value;
+    popped = empty_queue.pop(value);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  empty_queue.close();
+  consumer.join();
+  EXPECT_FALSE(popped);
+  // у закрытой очереди остались элементы, их уничтожит деструктор
+  EXPECT_EQ(queue.size(), size_t(2));
+}
+
+TEST(MpmcQueue, Many_Producers_Many_Consumers) {
+  constexpr int kThreads = 4;
+  constexpr int kPerProducer = 20000;
+  // маленькая емкость: обе стороны часто засыпают
+  s21::mpmc_queue<int> queue(8);
+  std::vector<std::vector<int>> received(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&queue, t] {
+      for (int i = 0; i < kPerProducer; ++i) {
+        int value = t * kPerProducer + i;
+        if (i % 2 == 0) {
+          queue.push(value);
+        } else {
+          while (!queue.try_push(value)) std::this_thread::yield();
+        }
+      }
+    });
+    threads.emplace_back([&queue, &received, t] {
+      int value;
+      while (queue.pop(value)) received[t].push_back(value);
+    });
+  }
+  for (int t = 0; t < kThreads; ++t) threads[2 * t].join();
+  queue.close();
+  for (int t = 0; t < kThreads; ++t) threads[2 * t + 1].join();
+  std::vector<int> seen(kThreads * kPerProducer, 0);
+  for (const std::vector<int> &part : received) {
+    // значения одного писателя приходят к читателю по возрастанию
+    std::vector<int> last(kThreads, -1);
+    for (int value : part) {
+      ++seen[value];
+      EXPECT_LT(last[value / kPerProducer], value);
+      last[value / kPerProducer] = value;
+    }
+  }
+  EXPECT_EQ(std::count(seen.begin(), seen.end(), 1), kThreads * kPerProducer);
+}
+}  // namespace
@@ -200,4 +200,164 @@ TEST(Multiset, Rehash_And_Insert_In_Collision) {
   EXPECT_EQ(s21_multiset.size(), std_multiset.size());
 }
 
+TEST(Multiset, Modifier_Merge) {
+  s21::multiset<int> s21_multiset_1 = {1, 3, 3, 5};
+  s21::multiset<int> s21_multiset_2 = {2, 3, 4};
+  std::multiset<int> std_multiset = {1, 2, 3, 3, 3, 4, 5};
+  s21_multiset_1.merge(s21_multiset_2);
+  auto it1 = s21_multiset_1.begin();
+  auto it2 = std_multiset.begin();
+  while (it2 != std_multiset.end()) {
+    EXPECT_EQ(*it1, *it2);
+    ++it1, ++it2;
+  }
+  EXPECT_EQ(s21_multiset_1.size(), std_multiset.size());
+  EXPECT_TRUE(s21_multiset_2.empty());
+  s21_multiset_2.insert(7);
+  EXPECT_EQ(s21_multiset_2.size(), size_t(1));
+}
+
+TEST(Multiset, Modifier_Merge_Keeps_Addresses) {
+  s21::multiset<std::string> s21_multiset = {"a", "b"};
+  s21::multiset<std::string> other = {"b", "c"};
+  const std::string *b = &*other.find("b");
+  // узел извлекается в отдельную память handle, пул other остается его
+  auto held = other.extract("c");
+  s21_multiset.merge(other);
+  bool found = false;
+  for (const std::string &value : s21_multiset) found |= &value == b;
+  EXPECT_TRUE(found);
+  EXPECT_EQ(s21_multiset.count("b"), size_t(2));
+  EXPECT_TRUE(other.empty());
+  const std::string *c = &held.value();
+  s21_multiset.insert(std::move(held));
+  EXPECT_EQ(&*s21_multiset.find("c"), c);
+}
+
+TEST(Multiset, Modifier_Insert_Hint) {
+  s21::multiset<int> s21_multiset;
+  std::multiset<int> std_multiset;
+  for (int i = 0; i < 50; ++i) {
+    s21_multiset.insert(s21_multiset.end(), i / 3);
+    std_multiset.insert(std_multiset.end(), i / 3);
+  }
+  s21_multiset.insert(s21_multiset.find(5), 5);
+  s21_multiset.insert(s21_multiset.begin(), 7);
+  std_multiset.insert({5, 7});
+  EXPECT_EQ(s21_multiset.size(), std_multiset.size());
+  auto it1 = s21_multiset.begin();
+  for (auto item : std_multiset) {
+    EXPECT_EQ(*it1, item);
+    ++it1;
+  }
+}
+
+TEST(Multiset, Lookup_Order_Statistic) {
+  s21::multiset<int, std::less<int>, s21::OrderStatistic> s21_multiset;
+  std::multiset<int> std_multiset;
+  for (int i = 0; i < 500; ++i) {
+    s21_multiset.insert((i * 37) % 101);
+    std_multiset.insert((i * 37) % 101);
+  }
+  for (int i = 0; i < 300; i += 2) {
+    s21_multiset.erase(s21_multiset.find(i % 101));
+    std_multiset.erase(std_multiset.find(i % 101));
+  }
+  size_t k = 0;
+  for (auto item : std_multiset) {
+    EXPECT_EQ(*s21_multiset.find_by_order(k), item);
+    ++k;
+  }
+  EXPECT_TRUE(s21_multiset.find_by_order(k) == s21_multiset.end());
+  for (int key = -1; key < 103; ++key) {
+    EXPECT_EQ(s21_multiset.order_of_key(key),
+              size_t(std::distance(std_multiset.begin(),
+                                   std_multiset.lower_bound(key))));
+  }
+}
+
+TEST(Multiset, Tree_Order_Statistic_Check) {
+  s21::RBTree<int, std::less<int>, s21::NodePool, s21::OrderStatistic> tree;
+  for (int i = 0; i < 200; ++i) tree.InsertKey((i * 13) % 50);
+  for (int i = 0; i < 150; i += 3) {
+    tree.Erase(tree.Find(i % 50));
+    EXPECT_TRUE(tree.TreeCheck());
+  }
+  tree.InsertKey(tree.end_(), 100, false);
+  EXPECT_TRUE(tree.TreeCheck());
+}
+
+TEST(Multiset, Modifier_Set_Operations) {
+  std::multiset<int> std_multiset_1 = {1, 1, 1, 2, 3, 3, 5};
+  std::multiset<int> std_multiset_2 = {1, 3, 3, 3, 4};
+  std::vector<int> std_union, std_intersection;
+  std::set_union(std_multiset_1.begin(), std_multiset_1.end(),
+                 std_multiset_2.begin(), std_multiset_2.end(),
+                 std::back_inserter(std_union));
+  std::set_intersection(std_multiset_1.begin(), std_multiset_1.end(),
+                        std_multiset_2.begin(), std_multiset_2.end(),
+                        std::back_inserter(std_intersection));
+
+  s21::multiset<int> s21_multiset_1 = {1, 1, 1, 2, 3, 3, 5};
+  s21::multiset<int> s21_multiset_2 = {1, 3, 3, 3, 4};
+  s21_multiset_1.set_union(s21_multiset_2);
+  EXPECT_TRUE(s21_multiset_2.empty());
+  EXPECT_EQ(s21_multiset_1.size(), std_union.size());
+  auto it = s21_multiset_1.begin();
+  for (auto item : std_union) {
+    EXPECT_EQ(*it, item);
+    ++it;
+  }
+
+  s21::multiset<int> s21_multiset_3 = {1, 1, 1, 2, 3, 3, 5};
+  s21::multiset<int> s21_multiset_4 = {1, 3, 3, 3, 4};
+  s21_multiset_3.set_intersection(s21_multiset_4);
+  EXPECT_EQ(s21_multiset_3.size(), std_intersection.size());
+  it = s21_multiset_3.begin();
+  for (auto item : std_intersection) {
+    EXPECT_EQ(*it, item);
+    ++it;
+  }
+}
+
+TEST(Multiset, Modifier_Extract_Insert_Node) {
+  s21::multiset<int> s21_multiset = {5, 1, 5, 3, 5};
+  auto node = s21_multiset.extract(5);
+  EXPECT_EQ(node.value(), 5);
+  EXPECT_EQ(s21_multiset.count(5), size_t(2));
+  node.value() = 3;
+  auto it = s21_multiset.insert(std::move(node));
+  EXPECT_EQ(*it, 3);
+  EXPECT_EQ(s21_multiset.count(3), size_t(2));
+  EXPECT_EQ(s21_multiset.size(), size_t(5));
+}
+
+TEST(Multiset, Lookup_Bounds) {
+  s21::multiset<int> s21_multiset = {1, 3, 3, 3, 5, 7, 7};
+  std::multiset<int> std_multiset = {1, 3, 3, 3, 5, 7, 7};
+  for (int key = 0; key < 9; ++key) {
+    auto s21_begin = s21_multiset.begin();
+    auto std_begin = std_multiset.begin();
+    EXPECT_EQ(std::distance(s21_begin, s21_multiset.lower_bound(key)),
+              std::distance(std_begin, std_multiset.lower_bound(key)));
+    EXPECT_EQ(std::distance(s21_begin, s21_multiset.upper_bound(key)),
+              std::distance(std_begin, std_multiset.upper_bound(key)));
+    EXPECT_EQ(s21_multiset.count(key), std_multiset.count(key));
+  }
+  s21::multiset<std::string, std::less<>> names = {"b", "a", "b", "c"};
+  EXPECT_EQ(names.count(std::string_view("b")), size_t(2));
+  EXPECT_EQ(*names.upper_bound(std::string_view("b")), "c");
+}
+
+TEST(Multiset, Modifier_Emplace) {
+  s21::multiset<std::string> s21_multiset;
+  auto it = s21_multiset.emplace(2, 'x');
+  EXPECT_EQ(*it, "xx");
+  s21_multiset.emplace("xx");
+  auto many = s21_multiset.insert_many("a", "xx");
+  EXPECT_TRUE(many[1].second);
+  EXPECT_EQ(s21_multiset.count("xx"), size_t(3));
+  EXPECT_EQ(s21_multiset.size(), size_t(4));
+}
+
 }  // namespace
@@ -0,0 +1,174 @@
+#include <random>
+
+#include "test_header.h"
+
+namespace {
+struct DerefLess {
+  bool operator()(const std::unique_ptr<int> &a,
+                  const std::unique_ptr<int> &b) const {
+    return *a < *b;
+  }
+};
+
+// Значение, которое нельзя построить из отрицательного числа
+struct NonNegative {
+  explicit NonNegative(int value) : value_(value) {
+    if (value < 0) throw std::invalid_argument("negative value");
+  }
+  bool operator<(const NonNegative &other) const {
+    return value_ < other.value_;
+  }
+  int value_;
+};
+
+TEST(PriorityQueue, Matches_Std_Priority_Queue) {
+  std::mt19937 gen(7);
+  std::vector<int> values(500);
+  for (int &value : values) value = int(gen() % 100);
+  // построение из диапазона - heapify, затем вперемешку push и pop
+  s21::priority_queue<int> s21_queue(values.begin(), values.end());
+  std::priority_queue<int> std_queue(values.begin(), values.end());
+  for (int i = 0; i < 2000; ++i) {
+    if (gen() % 3 != 0) {
+      int value = int(gen() % 1000);
+      s21_queue.push(value);
+      std_queue.push(value);
+    } else {
+      ASSERT_EQ(s21_queue.top(), std_queue.top());
+      s21_queue.pop();
+      std_queue.pop();
+    }
+  }
+  s21_queue.insert_many(5, 2000, 7);
+  std_queue.push(5), std_queue.push(2000), std_queue.push(7);
+  ASSERT_EQ(s21_queue.size(), std_queue.size());
+  while (!std_queue.empty()) {
+    ASSERT_EQ(s21_queue.top(), std_queue.top());
+    s21_queue.pop();
+    std_queue.pop();
+  }
+  EXPECT_TRUE(s21_queue.empty());
+  EXPECT_THROW(s21_queue.top(), std::logic_error);
+  EXPECT_THROW(s21_queue.pop(), std::logic_error);
+}
+
+TEST(PriorityQueue, Comparator_Container_And_Move_Only) {
+  s21::priority_queue<std::string, s21::vector<std::string>,
+                      std::greater<std::string>>
+      min_queue{"pear", "apple", "plum", "fig"};
+  min_queue.emplace(3, 'a');
+  EXPECT_EQ(min_queue.top(), "aaa");
+  min_queue.pop();
+  EXPECT_EQ(min_queue.top(), "apple");
+  s21::vector<int> heap_source{3, 1, 4, 1, 5, 9, 2, 6};
+  s21::priority_queue<int> from_container(std::less<int>(),
+                                          std::move(heap_source));
+  EXPECT_EQ(from_container.top(), 9);
+  s21::priority_queue<std::unique_ptr<int>, s21::vector<std::unique_ptr<int>>,
+                      DerefLess>
+      owners;
+  for (int i : {4, 8, 1}) owners.push(std::make_unique<int>(i));
+  EXPECT_EQ(*owners.top(), 8);
+  owners.pop();
+  EXPECT_EQ(*owners.top(), 4);
+}
+
+TEST(PriorityQueue, Insert_Many_Throwing_Constructor) {
+  s21::priority_queue<NonNegative> queue;
+  queue.insert_many(4, 1, 8);
+  // исключение на последнем аргументе: и при подъеме по одному, и при
+  // полной перестройке куча остается прежней
+  EXPECT_THROW(queue.insert_many(9, -1), std::invalid_argument);
+  EXPECT_THROW(queue.insert_many(20, 30, 40, -1), std::invalid_argument);
+  EXPECT_EQ(queue.size(), size_t(3));
+  queue.insert_many(2, 6);
+  std::vector<int> order;
+  while (!queue.empty()) {
+    order.push_back(queue.top().value_);
+    queue.pop();
+  }
+  EXPECT_EQ(order, std::vector<int>({8, 6, 4, 2, 1}));
+}
+
+TEST(PriorityQueue, Addressable_Promote_And_Erase) {
+  // очередь таймеров: наименьший срок наверху
+  s21::addressable_priority_queue<int, std::greater<int>> timers;
+  std::vector<size_t> handles;
+  for (int deadline = 100; deadline < 200; deadline += 10)
+    handles.push_back(timers.push(deadline));
+  EXPECT_EQ(timers.top(), 100);
+  timers.promote(handles[5], 50);
+  EXPECT_EQ(timers.top_handle(), handles[5]);
+  EXPECT_THROW(timers.promote(handles[5], 500), std::invalid_argument);
+  timers.update(handles[5], 175);
+  timers.erase(handles[0]);
+  EXPECT_FALSE(timers.contains(handles[0]));
+  EXPECT_THROW(timers.erase(handles[0]), std::out_of_range);
+  EXPECT_EQ(timers.value(handles[9]), 190);
+  // описатель удаленного элемента выдается снова
+  EXPECT_EQ(timers.push(95), handles[0]);
+  std::vector<int> order;
+  while (!timers.empty()) {
+    order.push_back(timers.top());
+    timers.pop();
+  }
+  EXPECT_EQ(order, std::vector<int>({95, 110, 120, 130, 140, 160, 170, 175,
+                                     180, 190}));
+  EXPECT_THROW(timers.pop(), std::logic_error);
+}
+
+TEST(PriorityQueue, Addressable_Promote_Default_Compare) {
+  // с std::less наверху максимум: повышение приоритета увеличивает значение
+  s21::addressable_priority_queue<int> queue;
+  std::vector<size_t> handles;
+  for (int value = 10; value <= 50; value += 10)
+    handles.push_back(queue.push(value));
+  EXPECT_EQ(queue.top(), 50);
+  queue.promote(handles[1], 60);
+  EXPECT_EQ(queue.top_handle(), handles[1]);
+  queue.promote(handles[0], 10);
+  EXPECT_THROW(queue.promote(handles[2], 5), std::invalid_argument);
+  EXPECT_EQ(queue.value(handles[2]), 30);
+  std::vector<int> order;
+  while (!queue.empty()) {
+    order.push_back(queue.top());
+    queue.pop();
+  }
+  EXPECT_EQ(order, std::vector<int>({60, 50, 40, 30, 10}));
+}
+
+TEST(PriorityQueue, Addressable_Random_Operations) {
+  std::mt19937 gen(11);
+  s21::addressable_priority_queue<int> queue;
+  std::multiset<int> model;
+  std::vector<std::pair<size_t, int>> live;
+  for (int i = 0; i < 5000; ++i) {
+    unsigned action = gen() % 5;
+    if (action < 2 || live.empty()) {
+      int value = int(gen() % 1000);
+      live.push_back({queue.push(value), value});
+      model.insert(value);
+    } else {
+      size_t k = gen() % live.size();
+      auto [handle, old_value] = live[k];
+      model.erase(model.find(old_value));
+      if (action == 2) {
+        queue.erase(handle);
+        live[k] = live.back();
+        live.pop_back();
+      } else {
+        int value = int(gen() % 1000);
+        queue.update(handle, value);
+        live[k].second = value;
+        model.insert(value);
+      }
+    }
+    ASSERT_EQ(queue.size(), model.size());
+    if (!model.empty()) {
+      ASSERT_EQ(queue.top(), *model.rbegin());
+    }
+  }
+  for (const auto &[handle, value] : live)
+    ASSERT_EQ(queue.value(handle), value);
+}
+}  // namespace
@@ -104,4 +104,25 @@ TEST(queue, Modifier_Swap) {
   }
 }
 
+TEST(Queue, Modifier_Emplace) {
+  s21::queue<std::pair<int, int>> s21_queue;
+  s21_queue.emplace_back(1, 2);
+  s21_queue.insert_many_back(std::make_pair(3, 4), std::make_pair(5, 6));
+  EXPECT_EQ(s21_queue.size(), size_t(3));
+  EXPECT_EQ(s21_queue.front().first, 1);
+  EXPECT_EQ(s21_queue.back().second, 6);
+}
+
+TEST(Queue, Container_List_And_Ring_Buffer) {
+  s21::queue<int, s21::list<int>> list_queue{1, 2, 3};
+  list_queue.push(4);
+  list_queue.pop();
+  EXPECT_EQ(list_queue.front(), 2);
+  EXPECT_EQ(list_queue.back(), 4);
+  // очередь по умолчанию забирает готовое кольцо без копирования
+  s21::ring_buffer<int> ring{5, 6};
+  s21::queue<int> queue(std::move(ring));
+  EXPECT_EQ(queue.front(), 5);
+  EXPECT_EQ(queue.size(), size_t(2));
+}
 }  // namespace
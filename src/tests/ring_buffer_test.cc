@@ -0,0 +1,56 @@
+#include <deque>
+
+#include "test_header.h"
+namespace {
+TEST(RingBuffer, Wraparound_And_Growth) {
+  s21::ring_buffer<std::string> s21_ring;
+  std::deque<std::string> std_deque;
+  // голова уходит вперед, хвост переходит через конец буфера, затем буфер
+  // растет с разорванной на две части последовательностью
+  for (int i = 0; i < 1000; ++i) {
+    s21_ring.push_back(std::to_string(i));
+    std_deque.push_back(std::to_string(i));
+    if (i % 3 == 0) {
+      s21_ring.pop_front();
+      std_deque.pop_front();
+    }
+    if (i % 7 == 0) {
+      s21_ring.emplace_front(2, 'f');
+      std_deque.emplace_front(2, 'f');
+    }
+  }
+  ASSERT_EQ(s21_ring.size(), std_deque.size());
+  EXPECT_EQ(s21_ring.capacity() & (s21_ring.capacity() - 1), size_t(0));
+  for (size_t i = 0; i < std_deque.size(); ++i)
+    EXPECT_EQ(s21_ring[i], std_deque[i]);
+  EXPECT_EQ(s21_ring.front(), std_deque.front());
+  EXPECT_EQ(s21_ring.back(), std_deque.back());
+  s21_ring.pop_back();
+  std_deque.pop_back();
+  EXPECT_EQ(s21_ring.back(), std_deque.back());
+  s21::ring_buffer<std::string> copy(s21_ring);
+  s21_ring.clear();
+  EXPECT_TRUE(s21_ring.empty());
+  EXPECT_THROW(s21_ring.front(), std::logic_error);
+  EXPECT_EQ(copy.size(), std_deque.size());
+  EXPECT_EQ(copy[5], std_deque[5]);
+}
+
+TEST(RingBuffer, Push_Own_Element_On_Growth) {
+  s21::ring_buffer<std::string> s21_ring;
+  s21_ring.reserve(20);
+  EXPECT_EQ(s21_ring.capacity(), size_t(32));
+  for (int i = 0; i < 32; ++i)
+    s21_ring.push_back(std::string(40, 'a' + i % 26));
+  // буфер полон: значение копируется раньше, чем старые элементы переедут
+  s21_ring.push_back(s21_ring.front());
+  s21_ring.push_front(s21_ring.back());
+  EXPECT_EQ(s21_ring.capacity(), size_t(64));
+  EXPECT_EQ(s21_ring.front(), std::string(40, 'a'));
+  EXPECT_EQ(s21_ring.back(), std::string(40, 'a'));
+  EXPECT_EQ(s21_ring[32], std::string(40, 'f'));
+  s21::ring_buffer<std::string> moved(std::move(s21_ring));
+  EXPECT_TRUE(s21_ring.empty());
+  EXPECT_EQ(moved.size(), size_t(34));
+}
+}  // namespace
@@ -1,3 +1,5 @@
+#include <thread>
+
 #include "test_header.h"
 
 namespace {
@@ -201,4 +203,258 @@ TEST(Set, Rehash_And_Insert_In_Collision) {
   EXPECT_EQ(s21_set.size(), std_set.size());
 }
 
+TEST(Set, Modifier_Erase_Reuse) {
+  s21::set<int> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 1000; ++i) {
+    s21_set.insert((i * 7919) % 1000);
+    std_set.insert((i * 7919) % 1000);
+  }
+  for (int i = 0; i < 1000; i += 3) {
+    s21_set.erase(s21_set.find(i));
+    std_set.erase(i);
+  }
+  for (int i = 0; i < 500; ++i) {
+    s21_set.insert(i * 3);
+    std_set.insert(i * 3);
+  }
+  auto it1 = s21_set.begin();
+  auto it2 = std_set.begin();
+  while (it2 != std_set.end()) {
+    EXPECT_EQ(*it1, *it2);
+    ++it1, ++it2;
+  }
+  EXPECT_EQ(s21_set.size(), std_set.size());
+}
+
+TEST(Set, Constructor_Range) {
+  std::vector<int> sorted = {1, 2, 3, 5, 8, 13, 21};
+  std::vector<int> unsorted = {13, 2, 8, 2, 1, 21, 5, 3};
+  s21::set<int> s21_set_1(sorted.begin(), sorted.end());
+  s21::set<int> s21_set_2(unsorted.begin(), unsorted.end());
+  std::set<int> std_set(sorted.begin(), sorted.end());
+  EXPECT_EQ(s21_set_1.size(), std_set.size());
+  EXPECT_EQ(s21_set_2.size(), std_set.size());
+  auto it1 = s21_set_1.begin();
+  auto it2 = s21_set_2.begin();
+  for (auto item : std_set) {
+    EXPECT_EQ(*it1, item);
+    EXPECT_EQ(*it2, item);
+    ++it1, ++it2;
+  }
+  s21_set_1.insert(4);
+  EXPECT_TRUE(s21_set_1.contains(4));
+}
+
+TEST(Set, Tree_Assign_Sorted) {
+  for (int count = 0; count < 130; ++count) {
+    std::vector<int> items(count);
+    for (int i = 0; i < count; ++i) items[i] = i * 2;
+    s21::RBTree<int> tree;
+    tree.AssignSorted(items.begin(), items.end());
+    EXPECT_TRUE(tree.TreeCheck());
+    EXPECT_EQ(tree._size_(), size_t(count));
+    for (int i = 0; i < count; i += 2) {
+      tree.Erase(tree.Find(i * 2));
+      tree.InsertKey(i * 2 + 1);
+    }
+    EXPECT_TRUE(tree.TreeCheck());
+  }
+}
+
+TEST(Set, Modifier_Insert_Hint) {
+  s21::set<int> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 100; ++i) {
+    s21_set.insert(s21_set.end(), i * 2);
+    std_set.insert(std_set.end(), i * 2);
+  }
+  auto hint = s21_set.find(10);
+  EXPECT_EQ(*s21_set.insert(hint, 9), 9);
+  EXPECT_EQ(*s21_set.insert(hint, 150), 150);
+  EXPECT_EQ(*s21_set.insert(s21_set.begin(), 10), 10);
+  EXPECT_EQ(*s21_set.emplace_hint(s21_set.begin(), -1), -1);
+  std_set.insert({9, 150, -1});
+  EXPECT_EQ(s21_set.size(), std_set.size());
+  auto it1 = s21_set.begin();
+  for (auto item : std_set) {
+    EXPECT_EQ(*it1, item);
+    ++it1;
+  }
+}
+
+TEST(Set, Modifier_Set_Operations) {
+  std::vector<int> items_1, items_2;
+  for (int i = 0; i < 300; ++i) items_1.push_back(i * 2);
+  for (int i = 0; i < 100; ++i) items_2.push_back(i * 3);
+  std::vector<int> std_union, std_intersection, std_difference;
+  std::set_union(items_1.begin(), items_1.end(), items_2.begin(),
+                 items_2.end(), std::back_inserter(std_union));
+  std::set_intersection(items_1.begin(), items_1.end(), items_2.begin(),
+                        items_2.end(), std::back_inserter(std_intersection));
+  std::set_difference(items_1.begin(), items_1.end(), items_2.begin(),
+                      items_2.end(), std::back_inserter(std_difference));
+
+  s21::set<int> s21_set_1(items_1.begin(), items_1.end());
+  s21::set<int> s21_set_2(items_2.begin(), items_2.end());
+  s21_set_1.set_union(s21_set_2);
+  EXPECT_TRUE(s21_set_2.empty());
+  EXPECT_EQ(std::vector<int>(s21_set_1.begin(), s21_set_1.end()), std_union);
+
+  s21::set<int> s21_set_3(items_1.begin(), items_1.end());
+  s21::set<int> s21_set_4(items_2.begin(), items_2.end());
+  s21_set_3.set_intersection(s21_set_4);
+  EXPECT_EQ(std::vector<int>(s21_set_3.begin(), s21_set_3.end()),
+            std_intersection);
+
+  s21::set<int> s21_set_5(items_1.begin(), items_1.end());
+  s21::set<int> s21_set_6(items_2.begin(), items_2.end());
+  s21_set_5.set_difference(s21_set_6);
+  EXPECT_EQ(std::vector<int>(s21_set_5.begin(), s21_set_5.end()),
+            std_difference);
+  EXPECT_EQ(s21_set_5.size(), std_difference.size());
+  s21_set_5.insert(1);
+  EXPECT_TRUE(s21_set_5.contains(1));
+}
+
+TEST(Set, Modifier_Extract_Insert_Node) {
+  s21::set<std::string> s21_set_1 = {"aboba", "shleppa", "amogus"};
+  s21::set<std::string> s21_set_2 = {"abobus"};
+  auto node = s21_set_1.extract("shleppa");
+  EXPECT_EQ(node.value(), "shleppa");
+  auto res = s21_set_2.insert(std::move(node));
+  EXPECT_TRUE(res.inserted);
+  EXPECT_EQ(*res.position, "shleppa");
+  EXPECT_EQ(s21_set_1.size(), size_t(2));
+  EXPECT_EQ(s21_set_2.size(), size_t(2));
+  EXPECT_TRUE(s21_set_2.contains("shleppa"));
+  EXPECT_FALSE(s21_set_1.contains("shleppa"));
+}
+
+TEST(Set, Modifier_Extract_Outlives_Container) {
+  s21::set<std::string>::node_type node;
+  {
+    s21::set<std::string> s21_set = {"aboba", "shleppa", "amogus"};
+    node = s21_set.extract(s21_set.begin());
+    s21_set.clear();
+  }
+  EXPECT_EQ(node.value(), "aboba");
+  s21::set<std::string> s21_set = {"abobus"};
+  s21_set.insert(std::move(node));
+  EXPECT_TRUE(node.empty());
+  EXPECT_TRUE(s21_set.contains("aboba"));
+  // узлы другого пула при слиянии переносятся, пока снаружи живет handle
+  s21::set<std::string> other = {"x", "y", "z"};
+  auto held = other.extract("y");
+  s21_set.merge(other);
+  s21_set.set_union(other);
+  EXPECT_EQ(s21_set.size(), size_t(4));
+  EXPECT_EQ(held.value(), "y");
+}
+
+TEST(Set, Modifier_Merge_Keeps_Addresses) {
+  s21::set<std::string> s21_set = {"b", "d"};
+  s21::set<std::string> other = {"a", "c"};
+  const std::string *moved = &*other.find("c");
+  // в other не остается ни одного элемента: узлы перевешиваются
+  s21_set.merge(other);
+  EXPECT_EQ(&*s21_set.find("c"), moved);
+  EXPECT_TRUE(other.empty());
+  other.insert("z");
+  // повтор "b" остается в other: элементы переносятся в новые узлы, а
+  // оставшийся элемент other не трогается
+  s21::set<std::string> rest = {"b", "e"};
+  const std::string *kept = &*rest.find("b");
+  s21_set.merge(rest);
+  EXPECT_EQ(&*rest.find("b"), kept);
+  EXPECT_EQ(rest.size(), size_t(1));
+  EXPECT_EQ(std::vector<std::string>(s21_set.begin(), s21_set.end()),
+            std::vector<std::string>({"a", "b", "c", "d", "e"}));
+  EXPECT_EQ(std::vector<std::string>(other.begin(), other.end()),
+            std::vector<std::string>({"z"}));
+}
+
+TEST(Set, Modifier_Merged_Sets_Are_Independent) {
+  // после слияния пулы не общие: контейнеры работают в разных потоках без
+  // синхронизации(проверяется в make test_tsan)
+  s21::set<int> left;
+  s21::set<int> right;
+  for (int i = 0; i < 1000; ++i) {
+    left.insert(2 * i);
+    right.insert(2 * i + 1);
+  }
+  left.merge(right);
+  for (int i = 0; i < 1000; ++i) right.insert(-i - 1);
+  s21::set<int>::node_type node = left.extract(0);
+  auto churn = [](s21::set<int> &set, int base) {
+    for (int i = 0; i < 2000; ++i) {
+      set.insert(base + i);
+      set.erase(set.find(base + i));
+    }
+  };
+  std::thread worker([&] {
+    churn(right, 100000);
+    node = s21::set<int>::node_type();
+  });
+  churn(left, 200000);
+  worker.join();
+  EXPECT_TRUE(node.empty());
+  EXPECT_EQ(left.size(), size_t(1999));
+  EXPECT_EQ(right.size(), size_t(1000));
+}
+
+TEST(Set, Modifier_Set_Operations_Leave_Sets_Independent) {
+  // операции забирают у other блоки пула целиком и не делят с ним память:
+  // после них оба множества работают в разных потоках(make test_tsan)
+  auto churn = [](s21::set<int> &set, int base) {
+    for (int i = 0; i < 1000; ++i) {
+      set.insert(base + i);
+      set.erase(set.find(base + i));
+    }
+  };
+  for (int op = 0; op < 3; ++op) {
+    s21::set<int> lhs;
+    s21::set<int> rhs;
+    for (int i = 0; i < 300; ++i) {
+      lhs.insert(2 * i);
+      rhs.insert(3 * i);
+    }
+    if (op == 0) lhs.set_union(rhs);
+    if (op == 1) lhs.set_intersection(rhs);
+    if (op == 2) lhs.set_difference(rhs);
+    for (int i = 0; i < 100; ++i) rhs.insert(-i - 1);
+    std::thread worker([&] { churn(rhs, 100000); });
+    churn(lhs, 200000);
+    worker.join();
+    EXPECT_EQ(rhs.size(), size_t(100));
+  }
+}
+
+TEST(Set, Lookup_Transparent) {
+  s21::set<std::string, std::less<>> s21_set = {"aboba", "amogus", "shleppa"};
+  std::string_view key = "amogus";
+  EXPECT_EQ(*s21_set.find(key), "amogus");
+  EXPECT_TRUE(s21_set.contains(std::string_view("shleppa")));
+  EXPECT_FALSE(s21_set.contains("abobus"));
+  EXPECT_EQ(s21_set.count(key), size_t(1));
+  EXPECT_EQ(*s21_set.lower_bound(std::string_view("ab")), "aboba");
+  EXPECT_EQ(*s21_set.upper_bound(key), "shleppa");
+  EXPECT_TRUE(s21_set.lower_bound("z") == s21_set.end());
+}
+
+TEST(Set, Modifier_Emplace) {
+  s21::set<std::string> s21_set;
+  auto res = s21_set.emplace(3, 'a');
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*res.first, "aaa");
+  res = s21_set.emplace("aaa");
+  EXPECT_FALSE(res.second);
+  auto many = s21_set.insert_many("b", "aaa", std::string("c"));
+  EXPECT_EQ(many.size(), size_t(3));
+  EXPECT_TRUE(many[0].second);
+  EXPECT_FALSE(many[1].second);
+  EXPECT_EQ(*many[2].first, "c");
+  EXPECT_EQ(s21_set.size(), size_t(3));
+}
+
 }  // namespace
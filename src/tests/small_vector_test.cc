@@ -0,0 +1,57 @@
+#include "test_header.h"
+namespace {
+TEST(SmallVector, Inline_Then_Heap) {
+  s21::small_vector<std::string, 4> s21_small;
+  std::vector<std::string> std_vector;
+  for (int i = 0; i < 4; ++i) {
+    s21_small.push_back(std::to_string(i));
+    std_vector.push_back(std::to_string(i));
+  }
+  EXPECT_TRUE(s21_small.is_inline());
+  EXPECT_EQ(s21_small.capacity(), size_t(4));
+  s21_small.emplace_back(3, 'x');
+  std_vector.emplace_back(3, 'x');
+  EXPECT_FALSE(s21_small.is_inline());
+  s21_small.insert(s21_small.begin() + 1, "a");
+  std_vector.insert(std_vector.begin() + 1, "a");
+  s21_small.erase(s21_small.begin());
+  std_vector.erase(std_vector.begin());
+  ASSERT_EQ(s21_small.size(), std_vector.size());
+  for (size_t i = 0; i < std_vector.size(); ++i)
+    EXPECT_EQ(s21_small.at(i), std_vector[i]);
+  s21_small.pop_back();
+  s21_small.pop_back();
+  s21_small.shrink_to_fit();
+  EXPECT_TRUE(s21_small.is_inline());
+  EXPECT_EQ(s21_small.size(), size_t(3));
+  EXPECT_EQ(s21_small.back(), "2");
+  s21_small.reserve(10);
+  EXPECT_FALSE(s21_small.is_inline());
+  EXPECT_EQ(s21_small.front(), "a");
+}
+
+TEST(SmallVector, Copy_Move_Swap) {
+  s21::small_vector<std::string, 2> inline_small = {"a"};
+  s21::small_vector<std::string, 2> heap_small = {"b", "c", "d"};
+  s21::small_vector<std::string, 2> copy = heap_small;
+  EXPECT_EQ(copy.size(), size_t(3));
+  EXPECT_EQ(copy[2], "d");
+  inline_small.swap(heap_small);
+  EXPECT_EQ(inline_small.size(), size_t(3));
+  EXPECT_FALSE(inline_small.is_inline());
+  EXPECT_EQ(heap_small.size(), size_t(1));
+  EXPECT_TRUE(heap_small.is_inline());
+  EXPECT_EQ(heap_small[0], "a");
+  s21::small_vector<std::string, 2> moved = std::move(heap_small);
+  EXPECT_TRUE(heap_small.empty());
+  EXPECT_EQ(moved.back(), "a");
+  moved = std::move(inline_small);
+  EXPECT_EQ(moved.size(), size_t(3));
+  EXPECT_EQ(moved[1], "c");
+  moved = copy;
+  moved.insert_many_back("e", "f");
+  EXPECT_EQ(moved.size(), size_t(5));
+  EXPECT_EQ(copy.size(), size_t(3));
+}
+
+}  // namespace
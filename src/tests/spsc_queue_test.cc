@@ -0,0 +1,82 @@
+#include <thread>
+
+#include "test_header.h"
+namespace {
+TEST(SpscQueue, Full_Empty_And_Wraparound) {
+  s21::spsc_queue<std::string, 4> queue;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.pop());
+  EXPECT_THROW(queue.front(), std::logic_error);
+  // индексы уходят далеко за емкость, ячейки переиспользуются по маске
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(queue.push(std::to_string(i)));
+    EXPECT_TRUE(queue.emplace(3, 'a' + i));
+    EXPECT_EQ(queue.front(), std::to_string(i));
+    EXPECT_TRUE(queue.pop());
+    std::string value;
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, std::string(3, 'a' + i));
+  }
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(queue.push(std::string(40, 'x')));
+  std::string rejected(40, 'y');
+  EXPECT_FALSE(queue.push(std::move(rejected)));
+  EXPECT_EQ(rejected, std::string(40, 'y'));
+  EXPECT_EQ(queue.size(), queue.capacity());
+  // оставшиеся элементы уничтожает деструктор
+}
+
+TEST(SpscQueue, Push_N_Pop_N_Batches) {
+  s21::spsc_queue<int, 8> queue;
+  std::vector<int> source{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  EXPECT_EQ(queue.push_n(source.begin(), 5), size_t(5));
+  // влезает только 3 из 5
+  EXPECT_EQ(queue.push_n(source.begin() + 5, 5), size_t(3));
+  EXPECT_EQ(queue.size(), size_t(8));
+  std::vector<int> out;
+  EXPECT_EQ(queue.pop_n(std::back_inserter(out), 6), size_t(6));
+  EXPECT_EQ(queue.push_n(source.begin() + 8, 2), size_t(2));
+  EXPECT_EQ(queue.pop_n(std::back_inserter(out), 100), size_t(4));
+  EXPECT_EQ(out, source);
+  EXPECT_EQ(queue.pop_n(std::back_inserter(out), 1), size_t(0));
+}
+
+TEST(SpscQueue, Two_Threads_Keep_Order) {
+  constexpr int kCount = 200000;
+  s21::spsc_queue<std::string, 64> queue;
+  std::thread producer([&queue] {
+    for (int i = 0; i < kCount;) {
+      if (i % 3 == 0) {
+        // пачка чисел через push_n
+        int n = std::min(16, kCount - i);
+        std::vector<std::string> batch;
+        for (int k = 0; k < n; ++k) batch.push_back(std::to_string(i + k));
+        int pushed = int(queue.push_n(batch.begin(), batch.size()));
+        if (pushed == 0) std::this_thread::yield();
+        i += pushed;
+      } else if (queue.push(std::to_string(i))) {
+        ++i;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  int expected = 0;
+  bool in_order = true;
+  std::vector<std::string> batch;
+  while (expected < kCount) {
+    batch.clear();
+    if (expected % 2 == 0) {
+      std::string value;
+      if (queue.pop(value)) batch.push_back(std::move(value));
+    } else {
+      queue.pop_n(std::back_inserter(batch), 32);
+    }
+    if (batch.empty()) std::this_thread::yield();
+    for (const std::string &value : batch)
+      in_order = in_order && value == std::to_string(expected++);
+  }
+  producer.join();
+  EXPECT_TRUE(in_order);
+  EXPECT_TRUE(queue.empty());
+}
+}  // namespace
@@ -101,4 +101,24 @@ TEST(Stack, Modifier_Swap) {
   }
 }
 
+TEST(Stack, Modifier_Emplace) {
+  s21::stack<std::pair<int, int>> s21_stack;
+  s21_stack.emplace(1, 2);
+  s21_stack.insert_many_front(std::make_pair(3, 4), std::make_pair(5, 6));
+  EXPECT_EQ(s21_stack.size(), size_t(3));
+  EXPECT_EQ(s21_stack.top().first, 5);
+  s21_stack.pop();
+  EXPECT_EQ(s21_stack.top().second, 4);
+}
+
+TEST(Stack, Container_Vector) {
+  s21::stack<int, s21::vector<int>> vector_stack;
+  vector_stack.push(1);
+  vector_stack.emplace(2);
+  vector_stack.insert_many_front(3, 4);
+  EXPECT_EQ(vector_stack.top(), 4);
+  vector_stack.pop();
+  EXPECT_EQ(vector_stack.top(), 3);
+  EXPECT_EQ(vector_stack.size(), size_t(3));
+}
 }  // namespace
@@ -129,4 +129,177 @@ TEST(Vector, Modifier_Swap) {
   EXPECT_EQ(s21_vector_2.size(), s21_vector_3.size());
 }
 
+TEST(Vector, Modifier_Push_Non_Default_Constructible) {
+  struct Item {
+    explicit Item(int value) : value_(std::to_string(value)) {}
+    std::string value_;
+  };
+  s21::vector<Item> s21_vector;
+  for (int i = 0; i < 100; ++i) s21_vector.push_back(Item(i));
+  s21_vector.insert(s21_vector.begin(), s21_vector.back());
+  s21_vector.insert(s21_vector.begin() + 50, Item(-1));
+  EXPECT_EQ(s21_vector.size(), size_t(102));
+  EXPECT_EQ(s21_vector.front().value_, "99");
+  EXPECT_EQ(s21_vector.at(50).value_, "-1");
+  EXPECT_EQ(s21_vector.back().value_, "99");
+  s21_vector.erase(s21_vector.begin() + 50);
+  s21_vector.pop_back();
+  EXPECT_EQ(s21_vector.back().value_, "98");
+  s21::vector<Item> copy = s21_vector;
+  s21_vector.clear();
+  EXPECT_TRUE(s21_vector.empty());
+  EXPECT_EQ(copy.at(1).value_, "0");
+}
+
+TEST(Vector, Modifier_Push_Counts_Constructions) {
+  static int constructed = 0;
+  static int destroyed = 0;
+  struct Counter {
+    Counter() { ++constructed; }
+    Counter(const Counter &) { ++constructed; }
+    Counter(Counter &&) noexcept { ++constructed; }
+    ~Counter() { ++destroyed; }
+  };
+  {
+    s21::vector<Counter> s21_vector;
+    for (int i = 0; i < 10; ++i) s21_vector.push_back(Counter());
+    // емкость 16, но живых объектов ровно 10
+    EXPECT_EQ(constructed - destroyed, 10);
+  }
+  EXPECT_EQ(constructed, destroyed);
+}
+
+TEST(Vector, Modifier_Emplace_In_Place) {
+  static int copied = 0;
+  struct Item {
+    Item(int value, std::string name) : value_(value), name_(name) {}
+    Item(const Item &other) : value_(other.value_), name_(other.name_) {
+      ++copied;
+    }
+    Item(Item &&) noexcept = default;
+    Item &operator=(Item &&) noexcept = default;
+    int value_;
+    std::string name_;
+  };
+  s21::vector<Item> s21_vector;
+  Item &last = s21_vector.emplace_back(2, "b");
+  EXPECT_EQ(last.name_, "b");
+  auto it = s21_vector.emplace(s21_vector.begin(), 1, "a");
+  EXPECT_EQ(it->value_, 1);
+  s21_vector.emplace(s21_vector.end(), 3, "c");
+  EXPECT_EQ(s21_vector.size(), size_t(3));
+  EXPECT_EQ(s21_vector.at(1).name_, "b");
+  EXPECT_EQ(copied, 0);
+}
+
+TEST(Vector, Modifier_Insert_Many) {
+  s21::vector<int> s21_vector = {1, 5};
+  auto it = s21_vector.insert_many(s21_vector.begin() + 1, 2, 3, 4);
+  EXPECT_EQ(*it, 4);
+  s21_vector.insert_many_back(6, 7);
+  EXPECT_EQ(s21_vector.size(), size_t(7));
+  for (size_t i = 0; i < s21_vector.size(); ++i)
+    EXPECT_EQ(s21_vector[i], int(i + 1));
+  it = s21_vector.insert_many(s21_vector.begin());
+  EXPECT_EQ(*it, 1);
+}
+
+TEST(Vector, Modifier_Insert_Range) {
+  s21::vector<std::string> s21_vector = {"a", "e"};
+  std::vector<std::string> std_vector = {"a", "e"};
+  std::list<std::string> source = {"b", "c", "d"};
+  auto it = s21_vector.insert(s21_vector.begin() + 1, source.begin(),
+                              source.end());
+  std_vector.insert(std_vector.begin() + 1, source.begin(), source.end());
+  EXPECT_EQ(*it, "b");
+  s21_vector.insert(s21_vector.end(), 2, s21_vector.front());
+  std_vector.insert(std_vector.end(), 2, std_vector.front());
+  s21_vector.reserve(20);
+  s21_vector.insert(s21_vector.begin(), 3, s21_vector.back());
+  std_vector.insert(std_vector.begin(), 3, std_vector.back());
+  s21_vector.insert(s21_vector.begin() + 2, {"x", "y"});
+  std_vector.insert(std_vector.begin() + 2, {"x", "y"});
+  std::string array[] = {"z", "w"};
+  s21_vector.append_range(array);
+  std_vector.insert(std_vector.end(), std::begin(array), std::end(array));
+  ASSERT_EQ(s21_vector.size(), std_vector.size());
+  for (size_t i = 0; i < std_vector.size(); ++i)
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  std::istringstream input("1 2 3");
+  s21::vector<int> ints = {0, 4};
+  ints.insert(ints.begin() + 1, std::istream_iterator<int>(input),
+              std::istream_iterator<int>());
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(ints[i], i);
+}
+
+TEST(Vector, Modifier_Erase_Range_Resize_Assign) {
+  s21::vector<int> s21_vector(5, 7);
+  EXPECT_EQ(s21_vector.size(), size_t(5));
+  EXPECT_EQ(s21_vector[4], 7);
+  s21_vector.assign({1, 2, 3, 4, 5, 6});
+  auto it = s21_vector.erase(s21_vector.begin() + 1, s21_vector.begin() + 4);
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(s21_vector.size(), size_t(3));
+  s21_vector.erase(s21_vector.begin(), s21_vector.begin());
+  EXPECT_EQ(s21_vector.size(), size_t(3));
+  s21_vector.resize(5);
+  EXPECT_EQ(s21_vector[4], 0);
+  s21_vector.resize(7, 9);
+  EXPECT_EQ(s21_vector[6], 9);
+  s21_vector.resize(2);
+  EXPECT_EQ(s21_vector.back(), 5);
+  s21_vector.assign(3, s21_vector.front());
+  EXPECT_EQ(s21_vector.size(), size_t(3));
+  EXPECT_EQ(s21_vector[2], 1);
+  std::vector<int> source = {8, 9};
+  s21_vector.assign(source.begin(), source.end());
+  EXPECT_EQ(s21_vector.size(), size_t(2));
+  EXPECT_EQ(s21_vector[1], 9);
+  s21::vector<std::string> strings(source.size(), "s");
+  strings.resize(4, "t");
+  strings.erase(strings.begin() + 1, strings.end() - 1);
+  EXPECT_EQ(strings.size(), size_t(2));
+  EXPECT_EQ(strings.back(), "t");
+}
+
+TEST(Vector, Capacity_Growth_Policy) {
+  s21::vector<int> doubling;
+  s21::vector<int, s21::OneAndHalfGrowth> one_and_half;
+  for (int i = 0; i < 5; ++i) {
+    doubling.push_back(i);
+    one_and_half.push_back(i);
+  }
+  EXPECT_EQ(doubling.capacity(), size_t(8));
+  EXPECT_EQ(one_and_half.capacity(), size_t(6));
+  doubling.reserve_exact(9);
+  EXPECT_EQ(doubling.capacity(), size_t(9));
+  doubling.reserve(10);
+  EXPECT_EQ(doubling.capacity(), size_t(18));
+  doubling.reserve(4);
+  EXPECT_EQ(doubling.capacity(), size_t(18));
+  EXPECT_EQ(doubling[4], 4);
+  EXPECT_THROW(doubling.reserve_exact(doubling.max_size() + 1),
+               std::length_error);
+}
+
+TEST(Vector, Capacity_Page_Rounded_Realloc) {
+  s21::vector<long, s21::PageRoundedGrowth> buffer;
+  for (long i = 0; i < 100000; ++i) buffer.push_back(i);
+  EXPECT_EQ(buffer.capacity() * sizeof(long) % 4096, size_t(0));
+  buffer.insert(buffer.begin() + 5, 3, buffer[7]);
+  buffer.append_range(std::vector<long>(50000, -1));
+  buffer.resize(buffer.size() + 10, buffer.front());
+  EXPECT_EQ(buffer.size(), size_t(150013));
+  EXPECT_EQ(buffer[6], 7);
+  EXPECT_EQ(buffer[8], 5);
+  EXPECT_EQ(buffer[99999 + 3], 99999);
+  EXPECT_EQ(buffer[150012], 0);
+  buffer.erase(buffer.begin() + 100, buffer.end());
+  buffer.shrink_to_fit();
+  EXPECT_EQ(buffer.capacity(), size_t(100));
+  s21::vector<std::string, s21::PageRoundedGrowth> strings(3, "a");
+  strings.emplace_back(strings.front());
+  EXPECT_EQ(strings.back(), "a");
+}
+
 }  // namespace
@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "test_header.h"
+namespace {
+TEST(WsDeque, Owner_Lifo_Thief_Fifo_And_Growth) {
+  s21::ws_deque<int> deque(4);
+  EXPECT_EQ(deque.capacity(), size_t(16));
+  EXPECT_THROW(s21::ws_deque<int>(SIZE_MAX), std::length_error);
+  int value = 0;
+  EXPECT_FALSE(deque.pop(value));
+  EXPECT_FALSE(deque.steal(value));
+  // кольцо растет дважды, пока вор уже сдвинул верхний конец
+  for (int i = 0; i < 10; ++i) deque.push(i);
+  EXPECT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 0);
+  for (int i = 10; i < 60; ++i) deque.push(i);
+  EXPECT_EQ(deque.capacity(), size_t(64));
+  EXPECT_EQ(deque.size(), size_t(59));
+  EXPECT_TRUE(deque.pop(value));
+  EXPECT_EQ(value, 59);
+  EXPECT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 1);
+  for (int expected = 58; expected >= 2; --expected) {
+    EXPECT_TRUE(deque.pop(value));
+    EXPECT_EQ(value, expected);
+  }
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop(value));
+  EXPECT_FALSE(deque.steal(value));
+}
+
+TEST(WsDeque, Thieves_And_Owner_Take_Each_Item_Once) {
+  constexpr int kThieves = 3;
+  constexpr int kCount = 100000;
+  s21::ws_deque<int> deque;
+  std::atomic<bool> done{false};
+  std::vector<std::vector<int>> stolen(kThieves);
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; ++t) {
+    thieves.emplace_back([&deque, &done, &stolen, t] {
+      int value;
+      while (!done.load(std::memory_order_acquire) || !deque.empty()) {
+        if (deque.steal(value))
+          stolen[t].push_back(value);
+        else
+          std::this_thread::yield();
+      }
+    });
+  }
+  std::vector<int> popped;
+  int value;
+  // владелец растит дек и забирает часть задач сам, в том числе последнюю,
+  // за которую спорит с ворами
+  for (int i = 0; i < kCount; ++i) {
+    deque.push(i);
+    if (i % 3 == 0 && deque.pop(value)) popped.push_back(value);
+  }
+  while (deque.pop(value)) popped.push_back(value);
+  done.store(true, std::memory_order_release);
+  for (std::thread &thief : thieves) thief.join();
+  std::vector<int> seen(kCount, 0);
+  for (int item : popped) ++seen[item];
+  for (const std::vector<int> &part : stolen) {
+    // вор видит задачи в порядке их появления
+    EXPECT_TRUE(std::is_sorted(part.begin(), part.end()));
+    for (int item : part) ++seen[item];
+  }
+  EXPECT_EQ(std::count(seen.begin(), seen.end(), 1), kCount);
+}
+}  // namespace